@@ -0,0 +1,222 @@
+# The faux dam break of 2d-faux-dam-break.i on a 25x25 mesh that is refined
+# up to 6 levels (the resolution of a 1600x1600 mesh) in a band around the
+# bores by SVShockIndicator and a ValueThresholdMarker, and coarsened behind
+# them.
+# Entropy viscosity keeps kappa / kappa_max close to 1 only at the bores.
+
+[GlobalParams]
+  g = 0.05
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 25
+  ny = 25
+  xmax = 4
+  ymax = 4
+[]
+
+[Functions]
+  [./initial_height]
+    type = ParsedFunction
+    value = '0.05 * (x < (2 + 1e-6)) + 0.01 * (x > (2 + 1e-6))'
+  [../]
+[]
+
+[Variables]
+  [./h]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_height
+    [../]
+  [../]
+
+  [./q_x]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0
+    [../]
+  [../]
+
+  [./q_y]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./geometry]
+    type = SVGeometryCache
+  [../]
+[]
+
+[Kernels]
+  [./h_time_derivative]
+    type = TimeDerivative
+    variable = h
+  [../]
+
+  [./h_continuity]
+    type = SVContinuity
+    variable = h
+    q_x = q_x
+    q_y = q_y
+  [../]
+
+  [./h_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = h
+  [../]
+
+  [./q_x_time_derivative]
+    type = TimeDerivative
+    variable = q_x
+  [../]
+
+  [./q_x_advection]
+    type = SVAdvection
+    variable = q_x
+    component = x
+    h = h
+    q_x = q_x
+    q_y = q_y
+  [../]
+
+  [./q_x_pressure]
+    type = SVPressure
+    variable = q_x
+    component = x
+    h = h
+  [../]
+
+  [./q_x_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = q_x
+  [../]
+
+  [./q_y_time_derivative]
+    type = TimeDerivative
+    variable = q_y
+  [../]
+
+  [./q_y_advection]
+    type = SVAdvection
+    variable = q_y
+    component = y
+    h = h
+    q_x = q_x
+    q_y = q_y
+  [../]
+
+  [./q_y_pressure]
+    type = SVPressure
+    variable = q_y
+    component = y
+    h = h
+  [../]
+
+  [./q_y_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = q_y
+  [../]
+[]
+
+[Materials]
+  [./sv_material]
+    type = SVMaterial
+    viscosity_type = ENTROPY
+    geometry = geometry
+    h = h
+    q_x = q_x
+    q_y = q_y
+  [../]
+[]
+
+[BCs]
+  [./BC_h]
+    type = SolidWallBC
+    variable = h
+    equation = CONTINUITY
+    h = h
+    boundary = 'top left bottom right'
+  [../]
+
+  [./BC_qx]
+    type = SolidWallBC
+    variable = q_x
+    equation = MOMENTUM
+    component = x
+    h = h
+    boundary = 'top left bottom right'
+  [../]
+
+  [./BC_qy]
+    type = SolidWallBC
+    variable = q_y
+    equation = MOMENTUM
+    component = y
+    h = h
+    boundary = 'top left bottom right'
+  [../]
+[]
+
+[Postprocessors]
+  [./dt]
+    type = TimeStepCFL
+    h = h
+    q_x = q_x
+    q_y = q_y
+    cfl = 0.25
+    geometry = geometry
+  [../]
+[]
+
+[Adaptivity]
+  marker = shock_marker
+  initial_steps = 6
+  max_h_level = 6
+  cycles_per_step = 1
+
+  [./Indicators]
+    [./shock]
+      type = SVShockIndicator
+      variable = h
+      use_viscosity = true
+      geometry = geometry
+    [../]
+  [../]
+
+  [./Markers]
+    [./shock_marker]
+      type = ValueThresholdMarker
+      variable = shock
+      refine = 0.5
+      coarsen = 0.05
+    [../]
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  end_time = 100
+
+  [./TimeStepper]
+    type = PostprocessorDT
+    postprocessor = dt
+    dt = 1e-6
+  [../]
+[]
+
+[Outputs]
+  exodus = true
+[]
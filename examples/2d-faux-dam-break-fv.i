@@ -0,0 +1,137 @@
+# The faux dam break of 2d-faux-dam-break.i solved with the cell-centered
+# central-upwind scheme and the explicit SSP-RK2 integrator.
+
+[GlobalParams]
+  g = 0.05
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 100
+  ny = 100
+  xmax = 4
+  ymax = 4
+[]
+
+[Functions]
+  [./initial_height]
+    type = ParsedFunction
+    value = '0.05 * (x < (2 + 1e-6)) + 0.01 * (x > (2 + 1e-6))'
+  [../]
+[]
+
+[Variables]
+  [./h]
+    family = MONOMIAL
+    order = CONSTANT
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_height
+    [../]
+  [../]
+
+  [./q_x]
+    family = MONOMIAL
+    order = CONSTANT
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0
+    [../]
+  [../]
+
+  [./q_y]
+    family = MONOMIAL
+    order = CONSTANT
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./fluxes]
+    type = SVCentralUpwindFluxes
+    h = h
+    q_x = q_x
+    q_y = q_y
+  [../]
+[]
+
+[Kernels]
+  [./h_time_derivative]
+    type = TimeDerivative
+    variable = h
+  [../]
+
+  [./q_x_time_derivative]
+    type = TimeDerivative
+    variable = q_x
+  [../]
+
+  [./q_y_time_derivative]
+    type = TimeDerivative
+    variable = q_y
+  [../]
+
+  [./central_upwind]
+    type = SVCentralUpwind
+    variable = h
+    q_x = q_x
+    q_y = q_y
+    fluxes = fluxes
+  [../]
+[]
+
+[BCs]
+  [./BC_qx]
+    type = SolidWallBC
+    variable = q_x
+    equation = MOMENTUM
+    component = x
+    h = h
+    boundary = 'top left bottom right'
+  [../]
+
+  [./BC_qy]
+    type = SolidWallBC
+    variable = q_y
+    equation = MOMENTUM
+    component = y
+    h = h
+    boundary = 'top left bottom right'
+  [../]
+[]
+
+[Postprocessors]
+  [./dt]
+    type = TimeStepCFL
+    h = h
+    q_x = q_x
+    q_y = q_y
+    cfl = 0.2
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = LINEAR
+  end_time = 100
+
+  [./TimeIntegrator]
+    type = SVExplicitSSPRungeKutta
+    order = 2
+  [../]
+
+  [./TimeStepper]
+    type = PostprocessorDT
+    postprocessor = dt
+    dt = 1e-6
+  [../]
+[]
+
+[Outputs]
+  exodus = true
+[]
@@ -0,0 +1,34 @@
+# Runs the members of scenarios.csv on river-reach-member.i, each a complete
+# sub-app with its own mesh and problem, one member per processor at a time,
+# and collects their final postprocessor values into
+# river-reach-ensemble_results.csv:
+#
+#   mpiexec -n 4 shallowwater-opt -i river-reach-ensemble.i
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Problem]
+  kernel_coverage_check = false
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
+
+[MultiApps]
+  [./ensemble]
+    type = SVScenarioLauncher
+    app_type = shallowwaterApp
+    input_files = river-reach-member.i
+    scenarios = scenarios.csv
+    postprocessors = 'h_middle q_outflow'
+    results = river-reach-ensemble_results.csv
+    execute_on = timestep_begin
+  [../]
+[]
@@ -0,0 +1,175 @@
+# A member of the river reach ensemble (river-reach-ensemble.i): a 1D reach
+# of length 1000 without bathymetry, initially at rest with h = 1, with an
+# imposed inflow discharge on the left and an imposed height on the right.
+#
+# The ensemble sets the discharge, the downstream height and the artificial
+# viscosity of each member from scenarios.csv. The member can also be run on
+# its own with the default values below.
+
+[GlobalParams]
+  g = 9.80665
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 200
+  xmin = 0
+  xmax = 1000
+[]
+
+[Variables]
+  [./h]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = ConstantIC
+      value = 1
+    [../]
+  [../]
+
+  [./q]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./h_time_derivative]
+    type = TimeDerivative
+    variable = h
+  [../]
+
+  [./h_continuity]
+    type = SVContinuity
+    variable = h
+    q_x = q
+  [../]
+
+  [./h_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = h
+  [../]
+
+  [./q_time_derivative]
+    type = TimeDerivative
+    variable = q
+  [../]
+
+  [./q_advection]
+    type = SVAdvection
+    variable = q
+    h = h
+    q_x = q
+    component = x
+  [../]
+
+  [./q_pressure]
+    type = SVPressure
+    variable = q
+    h = h
+    component = x
+  [../]
+
+  [./q_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = q
+  [../]
+[]
+
+[Materials]
+  [./sv_material]
+    type = SVMaterial
+    viscosity_type = FIRST_ORDER
+    h = h
+    q_x = q
+  [../]
+
+  [./inflow]
+    type = SVBoundaryState
+    boundary = left
+    imposed = DISCHARGE
+    h = h
+    q_x = q
+    h_imposed = 1
+    q_imposed = 0.5
+  [../]
+
+  [./outflow]
+    type = SVBoundaryState
+    boundary = right
+    imposed = HEIGHT
+    h = h
+    q_x = q
+    h_imposed = 1
+    q_imposed = 0
+  [../]
+[]
+
+[BCs]
+  [./h_left]
+    type = ImposedDischargeBC
+    variable = h
+    boundary = left
+    equation = CONTINUITY
+  [../]
+
+  [./q_left]
+    type = ImposedDischargeBC
+    variable = q
+    boundary = left
+    equation = MOMENTUM
+    component = x
+    h = h
+    q_x = q
+  [../]
+
+  [./h_right]
+    type = ImposedHeightBC
+    variable = h
+    boundary = right
+    equation = CONTINUITY
+    h = h
+    q_x = q
+  [../]
+
+  [./q_right]
+    type = ImposedHeightBC
+    variable = q
+    boundary = right
+    equation = MOMENTUM
+    component = x
+    h = h
+    q_x = q
+  [../]
+[]
+
+[Postprocessors]
+  [./h_middle]
+    type = PointValue
+    variable = h
+    point = '500 0 0'
+  [../]
+
+  [./q_outflow]
+    type = PointValue
+    variable = q
+    point = '1000 0 0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = NEWTON
+  end_time = 600
+  dt = 5
+[]
+
+[Outputs]
+  csv = true
+[]
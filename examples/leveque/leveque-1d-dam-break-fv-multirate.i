@@ -0,0 +1,144 @@
+# Case 13.2 from
+# "Finite Volume Methods for Hyperbolic Equations" by Leveque
+# (doc/refs/Leveque_book.pdf)
+#
+# Same problem as leveque-1d-dam-break.i, solved with the cell-centered
+# central-upwind scheme (doc/Chen-Kurganov-Lei-Liu.pdf) and the explicit
+# SSP-RK integrator. The zero-flow at the boundary is enforced by the
+# pressure-only flux of SolidWallBC.
+#
+# The mesh is graded (cell sizes span a factor of 20) and solved with
+# multirate time stepping: TimeStepMultirateCFL bins the cells into
+# power-of-two rate levels from their CFL timestep, which the explicit
+# integrator takes in substeps of the smallest timestep. The level of each
+# cell is exported in the aux variable level.
+#
+# Gravity, as used in the book, is g = 1.
+
+[GlobalParams]
+  g = 1.0
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1000
+  xmin = -5
+  xmax = 5
+  bias_x = 1.003
+[]
+
+[Functions]
+  [./initial_height]
+    type = ParsedFunction
+    value = '3 * (x < 0) + (x > 0)'
+  [../]
+[]
+
+[Variables]
+  [./h]
+    family = MONOMIAL
+    order = CONSTANT
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_height
+    [../]
+  [../]
+
+  [./q]
+    family = MONOMIAL
+    order = CONSTANT
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0
+    [../]
+  [../]
+[]
+
+[AuxVariables]
+  [./level]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[UserObjects]
+  [./fluxes]
+    type = SVCentralUpwindFluxes
+    h = h
+    q_x = q
+    multirate = dt
+  [../]
+[]
+
+[Kernels]
+  [./h_time_derivative]
+    type = TimeDerivative
+    variable = h
+  [../]
+
+  [./q_time_derivative]
+    type = TimeDerivative
+    variable = q
+  [../]
+
+  [./central_upwind]
+    type = SVCentralUpwind
+    variable = h
+    q_x = q
+    fluxes = fluxes
+  [../]
+[]
+
+[AuxKernels]
+  [./level_kernel]
+    type = SVMultirateAux
+    variable = level
+    quantity = LEVEL
+    multirate = dt
+  [../]
+[]
+
+[BCs]
+  [./BC_q]
+    type = SolidWallBC
+    variable = q
+    equation = MOMENTUM
+    component = x
+    h = h
+    boundary = 'left right'
+  [../]
+[]
+
+[Postprocessors]
+  [./dt]
+    type = TimeStepMultirateCFL
+    h = h
+    q_x = q
+    cfl = 0.45
+    max_level = 4
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = LINEAR
+  end_time = 2
+
+  [./TimeIntegrator]
+    type = SVExplicitSSPRungeKutta
+    order = 1
+    multirate = dt
+  [../]
+
+  [./TimeStepper]
+    type = PostprocessorDT
+    postprocessor = dt
+    dt = 1e-6
+  [../]
+[]
+
+[Outputs]
+  exodus = true
+[]
@@ -0,0 +1,118 @@
+# Case 13.2 from
+# "Finite Volume Methods for Hyperbolic Equations" by Leveque
+# (doc/refs/Leveque_book.pdf)
+#
+# Same problem as leveque-1d-dam-break.i, solved with the cell-centered
+# central-upwind scheme (doc/Chen-Kurganov-Lei-Liu.pdf) and the explicit
+# SSP-RK2 integrator. The zero-flow at the boundary is enforced by the
+# pressure-only flux of SolidWallBC.
+#
+# Gravity, as used in the book, is g = 1.
+
+[GlobalParams]
+  g = 1.0
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 5000
+  xmin = -5
+  xmax = 5
+[]
+
+[Functions]
+  [./initial_height]
+    type = ParsedFunction
+    value = '3 * (x < 0) + (x > 0)'
+  [../]
+[]
+
+[Variables]
+  [./h]
+    family = MONOMIAL
+    order = CONSTANT
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_height
+    [../]
+  [../]
+
+  [./q]
+    family = MONOMIAL
+    order = CONSTANT
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./fluxes]
+    type = SVCentralUpwindFluxes
+    h = h
+    q_x = q
+  [../]
+[]
+
+[Kernels]
+  [./h_time_derivative]
+    type = TimeDerivative
+    variable = h
+  [../]
+
+  [./q_time_derivative]
+    type = TimeDerivative
+    variable = q
+  [../]
+
+  [./central_upwind]
+    type = SVCentralUpwind
+    variable = h
+    q_x = q
+    fluxes = fluxes
+  [../]
+[]
+
+[BCs]
+  [./BC_q]
+    type = SolidWallBC
+    variable = q
+    equation = MOMENTUM
+    component = x
+    h = h
+    boundary = 'left right'
+  [../]
+[]
+
+[Postprocessors]
+  [./dt]
+    type = TimeStepCFL
+    h = h
+    q_x = q
+    cfl = 0.45
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = LINEAR
+  end_time = 2
+
+  [./TimeIntegrator]
+    type = SVExplicitSSPRungeKutta
+    order = 2
+  [../]
+
+  [./TimeStepper]
+    type = PostprocessorDT
+    postprocessor = dt
+    dt = 1e-6
+  [../]
+[]
+
+[Outputs]
+  exodus = true
+[]
@@ -0,0 +1,164 @@
+# Case 4.1.2 "Dam break on a dry domain without friction" (Ritter's
+# solution) from
+# "SWASHES: a compilation of Shallow Water Analytic Solutiosn for Hydraulic
+#  and Environmental Studies" by Delestre, et. al (doc/refs/SV_analytic.pdf)
+#
+# We have a domain of length 10 without bathymetry and a dam at x = 5.
+#
+# The intial height is
+#   h(x) = 0.005, x < 5,
+#          0,     x > 5
+# with a zero-flow initial condition of
+#   q(x) = 0.
+#
+# The water inundates the dry bed: the front moves at 2 sqrt(g h_l) and is
+# at x = 7.66 at t = 6, where the exact solution is compared. SVWetDryTracker
+# keeps the dry elements ahead of the front out of the solve, and the
+# velocity is zero wherever the height is below h_dry.
+
+[GlobalParams]
+  g = 9.81
+  implicit = false
+  wet_dry = wet_dry
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 400
+  xmin = 0
+  xmax = 10
+[]
+
+[Functions]
+  [./initial_height]
+    type = ParsedFunction
+    value = '0.005 * (x < 5)'
+  [../]
+[]
+
+[Variables]
+  [./h]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_height
+    [../]
+  [../]
+
+  [./q]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./wet_dry]
+    type = SVWetDryTracker
+    h = h
+    h_dry = 1e-6
+  [../]
+[]
+
+[Kernels]
+  [./h_time_derivative]
+    type = TimeDerivative
+    implicit = true
+    variable = h
+  [../]
+
+  [./h_continuity]
+    type = SVContinuity
+    variable = h
+    q_x = q
+  [../]
+
+  [./h_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = h
+  [../]
+
+  [./q_time_derivative]
+    type = TimeDerivative
+    implicit = true
+    variable = q
+  [../]
+
+  [./q_advection]
+    type = SVAdvection
+    variable = q
+    h = h
+    q_x = q
+    component = x
+  [../]
+
+  [./q_pressure]
+    type = SVPressure
+    variable = q
+    h = h
+    component = x
+  [../]
+
+  [./q_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = q
+  [../]
+[]
+
+[Materials]
+  [./sv_material]
+    type = SVMaterial
+    viscosity_type = FIRST_ORDER
+    h = h
+    q_x = q
+  [../]
+[]
+
+[BCs]
+  [./BC_q_left]
+    type = DirichletBC
+    variable = q
+    boundary = left
+    value = 0
+  [../]
+
+  [./BC_q_right]
+    type = DirichletBC
+    variable = q
+    boundary = right
+    value = 0
+  [../]
+[]
+
+[Postprocessors]
+  [./dt]
+    type = TimeStepCFL
+    h = h
+    q_x = q
+    cfl = 0.25
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = LINEAR
+  scheme = explicit-euler
+  l_tol = 1e-12
+  end_time = 6
+
+  [./TimeStepper]
+    type = PostprocessorDT
+    postprocessor = dt
+    dt = 1e-6
+  [../]
+[]
+
+[Outputs]
+  exodus = true
+[]
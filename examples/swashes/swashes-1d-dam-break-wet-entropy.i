@@ -0,0 +1,167 @@
+# Case 4.1.1 "Dam break on a wet domain without friction" (Stoker's
+# solution) from
+# "SWASHES: a compilation of Shallow Water Analytic Solutiosn for Hydraulic
+#  and Environmental Studies" by Delestre, et. al (doc/refs/SV_analytic.pdf)
+#
+# We have a domain of length 10 without bathymetry and a dam at x = 5.
+#
+# The intial height is
+#   h(x) = 0.005, x < 5,
+#          0.001, x > 5
+# with a zero-flow initial condition of
+#   q(x) = 0.
+#
+# The exact solution is compared at t = 6, before the waves reach the
+# boundary. Solved with entropy viscosity.
+
+[GlobalParams]
+  g = 9.81
+  implicit = false
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 400
+  xmin = 0
+  xmax = 10
+[]
+
+[Functions]
+  [./initial_height]
+    type = ParsedFunction
+    value = '0.005 * (x < 5) + 0.001 * (x > 5)'
+  [../]
+[]
+
+[Variables]
+  [./h]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_height
+    [../]
+  [../]
+
+  [./q]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0
+    [../]
+  [../]
+[]
+
+[AuxVariables]
+  [./v]
+  [../]
+[]
+
+[Kernels]
+  [./h_time_derivative]
+    type = TimeDerivative
+    implicit = true
+    variable = h
+  [../]
+
+  [./h_continuity]
+    type = SVContinuity
+    variable = h
+    q_x = q
+  [../]
+
+  [./h_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = h
+  [../]
+
+  [./q_time_derivative]
+    type = TimeDerivative
+    implicit = true
+    variable = q
+  [../]
+
+  [./q_advection]
+    type = SVAdvection
+    variable = q
+    h = h
+    q_x = q
+    component = x
+  [../]
+
+  [./q_pressure]
+    type = SVPressure
+    variable = q
+    h = h
+    component = x
+  [../]
+
+  [./q_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = q
+  [../]
+[]
+
+[AuxKernels]
+  [./v_kernel]
+    type = ParsedAux
+    variable = v
+    function = 'q / h'
+    args = 'q h'
+  [../]
+[]
+
+[Materials]
+  [./sv_material]
+    type = SVMaterial
+    viscosity_type = ENTROPY
+    h = h
+    q_x = q
+  [../]
+[]
+
+[BCs]
+  [./BC_q_left]
+    type = DirichletBC
+    variable = q
+    boundary = left
+    value = 0
+  [../]
+
+  [./BC_q_right]
+    type = DirichletBC
+    variable = q
+    boundary = right
+    value = 0
+  [../]
+[]
+
+[Postprocessors]
+  [./dt]
+    type = TimeStepCFL
+    h = h
+    q_x = q
+    cfl = 0.25
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = LINEAR
+  scheme = explicit-euler
+  l_tol = 1e-12
+  end_time = 6
+
+  [./TimeStepper]
+    type = PostprocessorDT
+    postprocessor = dt
+    dt = 1e-6
+  [../]
+[]
+
+[Outputs]
+  exodus = true
+[]
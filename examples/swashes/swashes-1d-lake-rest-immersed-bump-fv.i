@@ -0,0 +1,161 @@
+# Case 3.1.1 "Lake at rest with an immersed bump" from
+# "SWASHES: a compilation of Shallow Water Analytic Solutiosn for Hydraulic
+#  and Environmental Studies" by Delestre, et. al (doc/refs/SV_analytic.pdf)
+#
+# We have a domain of length 25 with bathymetry given by
+#   b(x) = 0.2 - 0.05(x - 10)^2,  if 8 < x < 12,
+#          0,                     otherwise.
+#
+# The topography is totally immersed such that the intial height is
+#   h(x) = 0.5 - b(x),
+# with a zero-flow initial condition of
+#   q(x) = 0.
+#
+# Solved with the cell-centered central-upwind scheme, which takes the
+# cell-averaged bathymetry b (not its gradient) and is well-balanced: the
+# residuals are expected to be 0 (to roundoff) at every time step.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 500
+  xmin = 0
+  xmax = 25
+[]
+
+[Functions]
+  [./initial_height]
+    type = ParsedFunction
+    value = '0.5 - (x > 8) * (x < 12) * (0.2 - 0.05 * (x - 10)^2)'
+  [../]
+
+  [./b_func]
+    type = ParsedFunction
+    value = '(x > 8) * (x < 12) * (0.2 - 0.05 * (x - 10)^2)'
+  [../]
+[]
+
+[Variables]
+  [./h]
+    family = MONOMIAL
+    order = CONSTANT
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_height
+    [../]
+  [../]
+
+  [./q]
+    family = MONOMIAL
+    order = CONSTANT
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0
+    [../]
+  [../]
+[]
+
+[AuxVariables]
+  [./b]
+    family = MONOMIAL
+    order = CONSTANT
+    [./InitialCondition]
+      type = FunctionIC
+      function = b_func
+    [../]
+  [../]
+
+  [./h_residual]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+
+  [./q_residual]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[UserObjects]
+  [./fluxes]
+    type = SVCentralUpwindFluxes
+    h = h
+    q_x = q
+    b = b
+  [../]
+[]
+
+[Kernels]
+  [./h_time_derivative]
+    type = TimeDerivative
+    variable = h
+  [../]
+
+  [./q_time_derivative]
+    type = TimeDerivative
+    variable = q
+  [../]
+
+  [./central_upwind]
+    type = SVCentralUpwind
+    variable = h
+    q_x = q
+    fluxes = fluxes
+  [../]
+[]
+
+[AuxKernels]
+  [./h_residual_kernel]
+    type = DebugResidualAux
+    variable = h_residual
+    debug_variable = h
+  [../]
+
+  [./q_residual_kernel]
+    type = DebugResidualAux
+    variable = q_residual
+    debug_variable = q
+  [../]
+[]
+
+[BCs]
+  [./BC_q]
+    type = SolidWallBC
+    variable = q
+    equation = MOMENTUM
+    component = x
+    h = h
+    boundary = 'left right'
+  [../]
+[]
+
+[Postprocessors]
+  [./dt]
+    type = TimeStepCFL
+    h = h
+    q_x = q
+    cfl = 0.45
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = LINEAR
+  num_steps = 10
+
+  [./TimeIntegrator]
+    type = SVExplicitSSPRungeKutta
+    order = 2
+  [../]
+
+  [./TimeStepper]
+    type = PostprocessorDT
+    postprocessor = dt
+    dt = 1e-6
+  [../]
+[]
+
+[Outputs]
+  exodus = true
+[]
@@ -0,0 +1,33 @@
+#ifndef SVDEMAUX_H
+#define SVDEMAUX_H
+
+#include "AuxKernel.h"
+
+// Forward Declarations
+class SVDEMAux;
+class SVDEM;
+
+template <>
+InputParameters validParams<SVDEMAux>();
+
+/**
+ * Samples the bathymetry or one component of its gradient from an SVDEM
+ * user object into an aux variable, for the objects that take b as a
+ * coupled variable and for output.
+ */
+class SVDEMAux : public AuxKernel
+{
+public:
+  SVDEMAux(const InputParameters & parameters);
+
+protected:
+  virtual Real computeValue() override;
+
+  /// Quantity to sample
+  const unsigned int _quantity;
+
+  /// Bathymetry provider
+  const SVDEM & _dem;
+};
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef SVMULTIRATEAUX_H
+#define SVMULTIRATEAUX_H
+
+#include "AuxKernel.h"
+
+// Forward Declarations
+class SVMultirateAux;
+class TimeStepMultirateCFL;
+
+template <>
+InputParameters validParams<SVMultirateAux>();
+
+/**
+ * Exports the rate level or the CFL timestep of every element from a
+ * TimeStepMultirateCFL postprocessor into an elemental aux variable.
+ */
+class SVMultirateAux : public AuxKernel
+{
+public:
+  SVMultirateAux(const InputParameters & parameters);
+
+protected:
+  virtual Real computeValue() override;
+
+  /// Quantity to export
+  const unsigned int _quantity;
+
+  /// Multirate levels
+  const TimeStepMultirateCFL & _multirate;
+};
+
+#endif
@@ -16,6 +16,11 @@ public:
 
 protected:
   virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  /// Jacobian with respect to the coupled variable jvar through the boundary state
+  Real computeQpStateJacobian(unsigned int jvar);
 
   /// Coupled momentum variables
   const VariableValue & _q_x;
@@ -24,16 +29,27 @@ protected:
   /// Coupled height variable
   const VariableValue & _h;
 
+  /// Coupled variable numbers
+  const unsigned int _h_ivar;
+  const unsigned int _q_x_ivar;
+  const unsigned int _q_y_ivar;
+
   /// Equation and component identifiers
   const unsigned int _eq;
   const unsigned int _comp;
 
-  /// Imposed values
-  const Real _h_imp;
-  const Real _q_imp;
-
   /// Gravity constant
   const Real _g;
+
+  /// State outside of the domain from SVBoundaryState
+  const MaterialProperty<Real> & _h_bc;
+  const MaterialProperty<Real> & _q_x_bc;
+  const MaterialProperty<Real> & _q_y_bc;
+
+  /// Derivatives of the state outside of the domain from SVBoundaryState
+  const MaterialProperty<RealVectorValue> & _dh_bc;
+  const MaterialProperty<RealVectorValue> & _dq_x_bc;
+  const MaterialProperty<RealVectorValue> & _dq_y_bc;
 };
 
 #endif // IMPOSEDHEIGHT_BC
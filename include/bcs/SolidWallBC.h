@@ -17,9 +17,12 @@ public:
 
 protected:
   virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
   /// Coupled height variable
   const VariableValue & _h;
+  const unsigned int _h_ivar;
 
   /// Equation and component identifiers
   const unsigned int _eq;
@@ -0,0 +1,45 @@
+#ifndef SVSHOCKINDICATOR_H
+#define SVSHOCKINDICATOR_H
+
+#include "ElementIndicator.h"
+
+// Forward Declarations
+class SVShockIndicator;
+class SVGeometryCache;
+
+template <>
+InputParameters validParams<SVShockIndicator>();
+
+/**
+ * Flags the elements with bores and wet/dry fronts for refinement. The
+ * indicator of an element is the largest of, over its quadrature points:
+ * the relative jump in height across the element h_cell |grad h| / h, 1 at
+ * a wet/dry front and, with use_viscosity, the ratio kappa / kappa_max of
+ * the artificial viscosity from SVMaterial. The ratio is only close to 1 at
+ * shocks with entropy viscosity: with first-order viscosity it is 1 on
+ * every element, which would refine the whole mesh. The elements are marked
+ * with a ValueThresholdMarker on the indicator.
+ */
+class SVShockIndicator : public ElementIndicator
+{
+public:
+  SVShockIndicator(const InputParameters & parameters);
+
+  virtual void computeIndicator() override;
+
+protected:
+  /// Whether or not to use the viscosity ratio
+  const bool _use_viscosity;
+
+  /// Artificial viscosity from SVMaterial (optional)
+  const MaterialProperty<Real> * const _kappa;
+  const MaterialProperty<Real> * const _kappa_max;
+
+  /// The height under which a point is dry, the one of the SVWetDryTracker if any
+  const Real _h_dry;
+
+  /// Cached element geometry (optional)
+  const SVGeometryCache * const _geometry;
+};
+
+#endif
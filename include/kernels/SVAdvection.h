@@ -1,7 +1,7 @@
 #ifndef SVADVECTION_H
 #define SVADVECTION_H
 
-#include "Kernel.h"
+#include "SVKernel.h"
 
 // Forward Declarations
 class SVAdvection;
@@ -9,15 +9,42 @@ class SVAdvection;
 template <>
 InputParameters validParams<SVAdvection>();
 
-class SVAdvection : public Kernel
+/**
+ * Computes the advection flux -(q_comp / h) q . grad(test) of a component of
+ * the momentum equation. The element residual and Jacobian loops are
+ * specialized on the mesh dimension, which is selected once at construction,
+ * so that the 1D kernel reads no y-component and the quadrature point sums
+ * have no virtual calls. Points with a height of at most h_dry advect nothing.
+ */
+class SVAdvection : public SVKernel
 {
 public:
   SVAdvection(const InputParameters & parameters);
 
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
 protected:
-  virtual Real computeQpResidual() override;
-  virtual Real computeQpJacobian() override;
-  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+  /// Unused: the residual is assembled in computeResidual()
+  virtual Real computeQpResidual() override { return 0; }
+
+  /// Residual and Jacobian for a mesh dimension
+  template <unsigned int dim>
+  void computeResidualT();
+  template <unsigned int dim>
+  void computeJacobianT();
+  template <unsigned int dim>
+  void computeOffDiagJacobianT(unsigned int jvar);
+
+  /// Adds sum_qp phi_j (coef . grad(test_i)) to the block of jvar
+  template <unsigned int dim>
+  void addJacobianBlock(unsigned int jvar);
+
+  /// The specializations for the mesh dimension
+  void (SVAdvection::*_compute_residual)();
+  void (SVAdvection::*_compute_jacobian)();
+  void (SVAdvection::*_compute_off_diag_jacobian)(unsigned int);
 
   /// Coupled water height variable
   const VariableValue & _h;
@@ -33,6 +60,9 @@ protected:
 
   /// Component of momentum to evaluate
   const unsigned int _comp;
+
+  /// Weighted coefficient vector of the residual or Jacobian at each quadrature point
+  std::vector<RealVectorValue> _coef;
 };
 
 #endif
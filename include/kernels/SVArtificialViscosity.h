@@ -1,25 +1,59 @@
 #ifndef SVARTIFICIALVISCOSITY_H
 #define SVARTIFICIALVISCOSITY_H
 
-#include "Kernel.h"
+#include "SVKernel.h"
 
 // Forward Declarations
 class SVArtificialViscosity;
+class SVGeometryCache;
 
 template <>
 InputParameters validParams<SVArtificialViscosity>();
 
-class SVArtificialViscosity : public Kernel
+/**
+ * Adds the artificial viscosity kappa grad(u) for the test functions of the
+ * nodes that are not on the boundary. The boundary nodes of each element are
+ * read from a mask (cached by SVGeometryCache when it is given) once per
+ * element, and the quadrature point sums are accumulated per interior test
+ * function. The loops are specialized on the mesh dimension, which is
+ * selected once at construction, so that the 1D dot products have a single
+ * term.
+ */
+class SVArtificialViscosity : public SVKernel
 {
 public:
   SVArtificialViscosity(const InputParameters & parameters);
 
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
 protected:
-  virtual Real computeQpResidual() override;
-  virtual Real computeQpJacobian() override;
+  /// Unused: the residual is assembled in computeResidual()
+  virtual Real computeQpResidual() override { return 0; }
+
+  /// Residual and Jacobian for a mesh dimension
+  template <unsigned int dim>
+  void computeResidualT();
+  template <unsigned int dim>
+  void computeJacobianT();
+
+  /// The specializations for the mesh dimension
+  void (SVArtificialViscosity::*_compute_residual)();
+  void (SVArtificialViscosity::*_compute_jacobian)();
+
+  /// Mask with bit i set if node i of the current element is on the boundary
+  unsigned int boundaryNodes() const;
 
   /// Viscosity coefficient
   const MaterialProperty<Real> & _kappa;
+
+  /// Cached element geometry (optional)
+  const SVGeometryCache * const _geometry;
+
+  /// Weighted viscous flux and viscosity at each quadrature point
+  std::vector<RealGradient> _flux;
+  std::vector<Real> _kappa_JxW;
 };
 
 #endif
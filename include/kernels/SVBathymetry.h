@@ -1,23 +1,40 @@
 #ifndef SVBATHYMETRY_H
 #define SVBATHYMETRY_H
 
-#include "Kernel.h"
+#include "SVKernel.h"
+#include "MeshChangedInterface.h"
+
+#include <unordered_map>
 
 // Forward Declarations
 class SVBathymetry;
+class SVDEM;
 
 template <>
 InputParameters validParams<SVBathymetry>();
 
-class SVBathymetry : public Kernel
+class SVBathymetry : public SVKernel, public MeshChangedInterface
 {
 public:
   SVBathymetry(const InputParameters & parameters);
 
+  virtual void computeResidual() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
+  /// The element ids are no longer valid: look the DEM up again
+  virtual void meshChanged() override { _dem_grad_b.clear(); }
+
 protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
+  /// Points _elem_dem_grad_b to the DEM gradient at the quadrature points of
+  /// the element, which is looked up on the first visit of the element only
+  void computeDEMGradient();
+
+  /// Component of the bathymetry gradient at _qp
+  Real gradB() const;
+
   /// Coupled water height variable
   const VariableValue & _h;
 
@@ -28,6 +45,15 @@ protected:
   // const VariableGradient & _grad_b;
   const VariableValue & _grad_b;
 
+  /// Bathymetry from a DEM (optional, in place of b)
+  const SVDEM * const _dem;
+
+  /// Component of the DEM bathymetry gradient at the quadrature points, by element id
+  std::unordered_map<dof_id_type, std::vector<Real>> _dem_grad_b;
+
+  /// Component of the DEM bathymetry gradient at the quadrature points of the current element
+  const std::vector<Real> * _elem_dem_grad_b;
+
   /// Component of b to evaluate
   const unsigned int _comp;
 
@@ -0,0 +1,44 @@
+#ifndef SVCENTRALUPWIND_H
+#define SVCENTRALUPWIND_H
+
+#include "SVKernel.h"
+
+// Forward Declarations
+class SVCentralUpwind;
+class SVCentralUpwindFluxes;
+
+template <>
+InputParameters validParams<SVCentralUpwind>();
+
+/**
+ * Adds the net outward central-upwind flux of every cell, computed by
+ * SVCentralUpwindFluxes, to the residuals of all of the Saint-Venant
+ * equations. The kernel is applied to the height variable, which along with
+ * the momentum variables must be CONSTANT MONOMIAL. No Jacobian is assembled:
+ * the scheme is meant for explicit time integration.
+ */
+class SVCentralUpwind : public SVKernel
+{
+public:
+  SVCentralUpwind(const InputParameters & parameters);
+
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override {}
+  virtual void computeOffDiagJacobian(unsigned int /*jvar*/) override {}
+
+protected:
+  /// Unused: the residual is assembled in computeResidual()
+  virtual Real computeQpResidual() override { return 0; }
+
+  /// Equation indices
+  const unsigned int _q_x_ivar;
+  const unsigned int _q_y_ivar;
+
+  /// Whether or not the y-component of momentum exists (2D)
+  const bool _has_q_y;
+
+  /// The face fluxes
+  const SVCentralUpwindFluxes & _fluxes;
+};
+
+#endif
@@ -1,7 +1,7 @@
 #ifndef SVCONTINUITY_H
 #define SVCONTINUITY_H
 
-#include "Kernel.h"
+#include "SVKernel.h"
 
 // Forward Declarations
 class SVContinuity;
@@ -9,14 +9,34 @@ class SVContinuity;
 template <>
 InputParameters validParams<SVContinuity>();
 
-class SVContinuity : public Kernel
+/**
+ * Computes the flux -q . grad(test) of the continuity equation. The element
+ * residual and Jacobian loops are specialized on the mesh dimension, which is
+ * selected once at construction, so that the 1D kernel reads no y-component
+ * and the quadrature point sums have no virtual calls.
+ */
+class SVContinuity : public SVKernel
 {
 public:
   SVContinuity(const InputParameters & parameters);
 
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
 protected:
-  virtual Real computeQpResidual() override;
-  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+  /// Unused: the residual is assembled in computeResidual()
+  virtual Real computeQpResidual() override { return 0; }
+
+  /// Residual and off-diagonal Jacobian for a mesh dimension
+  template <unsigned int dim>
+  void computeResidualT();
+  template <unsigned int dim>
+  void computeOffDiagJacobianT(unsigned int jvar);
+
+  /// The specializations for the mesh dimension
+  void (SVContinuity::*_compute_residual)();
+  void (SVContinuity::*_compute_off_diag_jacobian)(unsigned int);
 
   /// Coupled momentum variables
   const VariableValue & _q_x;
@@ -25,6 +45,9 @@ protected:
   /// Equation indices
   const unsigned int _q_x_ivar;
   const unsigned int _q_y_ivar;
+
+  /// Weighted momentum at each quadrature point
+  std::vector<RealVectorValue> _flux;
 };
 
 #endif
@@ -0,0 +1,81 @@
+#ifndef SVFUSED_H
+#define SVFUSED_H
+
+#include "SVKernel.h"
+
+// Forward Declarations
+class SVFused;
+class SVGeometryCache;
+
+template <>
+InputParameters validParams<SVFused>();
+
+/**
+ * Assembles the continuity, advection, pressure, bathymetry and artificial
+ * viscosity terms of all of the Saint-Venant equations in a single pass over
+ * the quadrature points. The kernel is applied to the height variable and
+ * writes directly into the residual and Jacobian blocks of the momentum
+ * variables, which must share the finite element type of the height.
+ *
+ * The assembly loops are specialized on the mesh dimension, which is selected
+ * once at construction, so that the 1D loops carry no y-component terms.
+ */
+class SVFused : public SVKernel
+{
+public:
+  SVFused(const InputParameters & parameters);
+
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
+protected:
+  /// Unused: the residual is assembled in computeResidual()
+  virtual Real computeQpResidual() override { return 0; }
+
+  /// Residual and Jacobian of all of the equations for a mesh dimension
+  template <unsigned int dim>
+  void computeResidualT();
+  template <unsigned int dim>
+  void computeJacobianT();
+
+  /// The specializations for the mesh dimension
+  void (SVFused::*_compute_residual)();
+  void (SVFused::*_compute_jacobian)();
+
+  /// Mask with bit i set if node i of the current element is on the boundary
+  unsigned int boundaryNodes() const;
+
+  /// The Jacobian block for (ivar, jvar) if it is assembled, otherwise nullptr
+  DenseMatrix<Number> * offDiagBlock(unsigned int ivar, unsigned int jvar);
+
+  /// Coupled momentum variables
+  const VariableValue & _q_x;
+  const VariableValue & _q_y;
+  const VariableGradient & _grad_q_x;
+  const VariableGradient & _grad_q_y;
+
+  /// Equation indices
+  const unsigned int _q_x_ivar;
+  const unsigned int _q_y_ivar;
+
+  /// Whether or not the y-component of momentum exists (2D)
+  const bool _has_q_y;
+
+  /// Constant of gravity
+  const Real _g;
+
+  /// Bathymetry gradient components (optional)
+  const bool _has_bathymetry;
+  const VariableValue & _grad_b_x;
+  const VariableValue & _grad_b_y;
+
+  /// Viscosity coefficient (optional)
+  const bool _has_viscosity;
+  const MaterialProperty<Real> * _kappa;
+
+  /// Cached element geometry (optional)
+  const SVGeometryCache * const _geometry;
+};
+
+#endif
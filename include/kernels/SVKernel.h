@@ -0,0 +1,69 @@
+#ifndef SVKERNEL_H
+#define SVKERNEL_H
+
+#include "Kernel.h"
+
+// Saint-Venant includes
+#include "SVCounters.h"
+
+// Forward Declarations
+class SVKernel;
+class SVWetDryTracker;
+class TimeStepMultirateCFL;
+
+template <>
+InputParameters validParams<SVKernel>();
+
+/**
+ * Base class for the Saint-Venant kernels, which skips the residual and
+ * Jacobian on elements that the (optional) SVWetDryTracker marks as dry.
+ * Kernels that divide by the height treat the quadrature points of the
+ * remaining (halo) elements with a height of at most h_dry as dry.
+ * With multirate time stepping, the residual of each element is weighted
+ * by the rate of its level in the current substep (TimeStepMultirateCFL).
+ * The calls, time and quadrature points of the residual and Jacobian are
+ * counted (SVCounters) under the type of the kernel.
+ */
+class SVKernel : public Kernel
+{
+public:
+  SVKernel(const InputParameters & parameters);
+
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
+protected:
+  /// Whether or not the current element is dry and should be skipped
+  bool dry() const;
+
+  /// Weight of the residual of the current element (0 if it is skipped)
+  Real weight() const;
+
+  /// Dot product of the first dim components of two vectors, for the loops
+  /// that are specialized on the mesh dimension
+  template <unsigned int dim>
+  static Real dot(const RealVectorValue & a, const RealVectorValue & b)
+  {
+    return dim == 2 ? a(0) * b(0) + a(1) * b(1) : a(0) * b(0);
+  }
+
+  /// Wet/dry tracking (optional)
+  const SVWetDryTracker * const _wet_dry;
+
+  /// Height under which a quadrature point is dry (0 without wet/dry tracking)
+  const Real _h_dry;
+
+  /// Multirate levels (optional)
+  const TimeStepMultirateCFL * const _multirate;
+
+  /// Counters: calls and time of the residual and Jacobian, quadrature points visited
+  SVCounters _counters;
+  Real & _residual_calls;
+  Real & _residual_time;
+  Real & _jacobian_calls;
+  Real & _jacobian_time;
+  Real & _qps;
+};
+
+#endif
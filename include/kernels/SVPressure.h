@@ -1,7 +1,7 @@
 #ifndef SVPRESSURE_H
 #define SVPRESSURE_H
 
-#include "Kernel.h"
+#include "SVKernel.h"
 
 // Forward Declarations
 class SVPressure;
@@ -9,7 +9,7 @@ class SVPressure;
 template <>
 InputParameters validParams<SVPressure>();
 
-class SVPressure : public Kernel
+class SVPressure : public SVKernel
 {
 public:
   SVPressure(const InputParameters & parameters);
@@ -0,0 +1,105 @@
+#ifndef SVBOUNDARYSTATE_H
+#define SVBOUNDARYSTATE_H
+
+#include "Material.h"
+
+// Saint-Venant includes
+#include "SVCounters.h"
+
+// Forward Declarations
+class SVBoundaryState;
+class MooseMesh;
+
+template <>
+InputParameters validParams<SVBoundaryState>();
+
+/**
+ * Computes the state (h, q_x, q_y) outside of the domain on a boundary with
+ * an imposed height or discharge from the characteristics of the flow. The
+ * state is computed once per side quadrature point and shared by the
+ * continuity and momentum boundary conditions on the boundary, along with
+ * its derivatives with respect to the state (h, q_x, q_y) inside the domain
+ * for the boundary Jacobians. The imposed discharge is also declared as the
+ * property q_imposed, so that ImposedDischargeBC reads it from the state
+ * rather than from a parameter of its own. The iterations of the fluvial Newton solve and
+ * the warnings when it does not converge are counted (SVCounters).
+ */
+class SVBoundaryState : public Material
+{
+public:
+  SVBoundaryState(const InputParameters & parameters);
+
+  /**
+   * Errors out unless every boundary of a boundary condition has an
+   * SVBoundaryState material with the given imposed value type. The materials
+   * are built after the boundary conditions, so the input is checked.
+   */
+  static void checkBoundaries(MooseObject & bc,
+                              MooseMesh & mesh,
+                              const std::set<BoundaryID> & boundary_ids,
+                              const std::string & imposed);
+
+protected:
+  virtual void computeProperties() override;
+  virtual void initQpStatefulProperties() override;
+  virtual void computeQpProperties() override;
+
+  /// Boundary state with an imposed discharge
+  void computeQpImposedDischarge();
+
+  /// Boundary state with an imposed height
+  void computeQpImposedHeight();
+
+  /// Initial guess for the height in the fluvial Newton iteration
+  Real initialHeightGuess() const;
+
+  /// Sets the state outside of the domain to the state inside the domain
+  void setInteriorState();
+
+  /// Imposed value type
+  const unsigned int _imposed;
+
+  /// Coupled variables
+  const VariableValue & _h;
+  const VariableValue & _q_x;
+  const VariableValue & _q_y;
+
+  /// Imposed values
+  const Real _h_imp;
+  const Real _q_imp;
+
+  /// Gravity constant
+  const Real _g;
+
+  /// Parameters for Newton iteration
+  const unsigned int _newton_max;
+  const Real _newton_abs_tol;
+
+  /// Declared material properties: the state outside of the domain
+  MaterialProperty<Real> & _h_bc;
+  MaterialProperty<Real> & _q_x_bc;
+  MaterialProperty<Real> & _q_y_bc;
+
+  /// Derivatives of the state outside of the domain with respect to the
+  /// state (h, q_x, q_y) inside the domain, stored as the components (0, 1, 2)
+  MaterialProperty<RealVectorValue> & _dh_bc;
+  MaterialProperty<RealVectorValue> & _dq_x_bc;
+  MaterialProperty<RealVectorValue> & _dq_y_bc;
+
+  /// Declared material property: the imposed discharge, for ImposedDischargeBC
+  MaterialProperty<Real> & _q_imposed;
+
+  /// Height from the previous step, which warm-starts the Newton iteration
+  const MaterialProperty<Real> * const _h_bc_old;
+
+  /// Counters: calls and time of computeProperties(), quadrature points visited,
+  /// Newton iterations and the warnings of the Newton iterations that did not converge
+  SVCounters _counters;
+  Real & _calls;
+  Real & _time;
+  Real & _qps;
+  Real & _newton_iterations;
+  Real & _warnings;
+};
+
+#endif
@@ -3,12 +3,23 @@
 
 #include "Material.h"
 
+// Saint-Venant includes
+#include "SVCounters.h"
+
 // Forward Declarations
 class SVMaterial;
+class SVGeometryCache;
+class SVWetDryTracker;
 
 template <>
 InputParameters validParams<SVMaterial>();
 
+/**
+ * Computes the artificial viscosity kappa (and its first-order bound
+ * kappa_max) of the Saint-Venant equations. The quadrature point loop is
+ * specialized on the mesh dimension and the viscosity type, which are
+ * selected once at construction.
+ */
 class SVMaterial : public Material
 {
 public:
@@ -18,6 +29,26 @@ protected:
   virtual void computeProperties();
   virtual void computeQpProperties();
 
+  /// Quadrature point loop for a dimension and viscosity type
+  template <unsigned int dim, unsigned int viscosity_type>
+  void computePropertiesT();
+
+  /// Properties at _qp for a dimension and viscosity type
+  template <unsigned int dim, unsigned int viscosity_type>
+  void computeQpPropertiesT();
+
+  /// Entropy residual at the current quadrature point
+  template <unsigned int dim>
+  Real computeQpEntropyResidual();
+
+  /// Selects the specializations for the mesh dimension and viscosity type
+  template <unsigned int dim>
+  void selectSpecialization();
+
+  /// The specializations in use
+  void (SVMaterial::*_compute_properties)();
+  void (SVMaterial::*_compute_qp_properties)();
+
   /// Viscosity type
   const MooseEnum _viscosity_type;
 
@@ -29,12 +60,21 @@ protected:
   const VariableValue & _q_x;
   const VariableValue & _q_y;
 
+  /// Coupled old values and gradients (entropy viscosity only)
+  const VariableValue & _h_old;
+  const VariableValue & _q_x_old;
+  const VariableValue & _q_y_old;
+  const VariableGradient & _grad_h;
+  const VariableGradient & _grad_q_x;
+  const VariableGradient & _grad_q_y;
+
   /// Gravity constant
   const Real _g;
 
   /// Viscosity approximation coefficients
   const Real _C_max_0;
   Real _C_max = 0;
+  const Real _C_entropy;
 
   /// Time to add extra artificial visocsity
   const Real _extra_duration;
@@ -43,8 +83,23 @@ protected:
   MaterialProperty<Real> & _kappa;
   MaterialProperty<Real> & _kappa_max;
 
+  /// Cached element geometry (optional)
+  const SVGeometryCache * const _geometry;
+
+  /// Wet/dry tracking (optional)
+  const SVWetDryTracker * const _wet_dry;
+
+  /// Height under which a quadrature point is dry (0 without wet/dry tracking)
+  const Real _h_dry;
+
   /// Characteristic cell length
   Real _h_cell;
+
+  /// Counters: calls and time of computeProperties(), quadrature points visited
+  SVCounters _counters;
+  Real & _calls;
+  Real & _time;
+  Real & _qps;
 };
 
 #endif
@@ -0,0 +1,56 @@
+#ifndef SVSCENARIOLAUNCHER_H
+#define SVSCENARIOLAUNCHER_H
+
+#include "FullSolveMultiApp.h"
+
+// Forward Declarations
+class SVScenarioLauncher;
+
+template <>
+InputParameters validParams<SVScenarioLauncher>();
+
+/**
+ * Launches a set of Saint-Venant scenarios as the sub-apps of a single
+ * process, one sub-app per row of a scenario table. The table is a CSV file
+ * whose header holds the parameters that differ between the scenarios, as
+ * command line paths (e.g. Materials/inflow/q_imposed or
+ * Materials/sv_material/C_max), and whose rows hold their values (quoted on
+ * the command line when they contain spaces).
+ *
+ * Only the process is shared: every scenario is a complete sub-app that builds
+ * its own mesh, DOF map and problem from the input file. The scenarios are
+ * distributed over the processors by the MultiApp (one processor per scenario
+ * by default), so that they run concurrently without paying for their own
+ * process start. At the end of each solve, the final values of the requested
+ * postprocessors of every scenario are gathered into a CSV file along with
+ * the scenario parameters, and the throughput in scenarios per hour is
+ * reported.
+ */
+class SVScenarioLauncher : public FullSolveMultiApp
+{
+public:
+  SVScenarioLauncher(const InputParameters & parameters);
+
+  virtual bool solveStep(Real dt, Real target_time, bool auto_advance = true) override;
+
+protected:
+  /// Reads the scenario table into the positions and command line arguments of the scenarios
+  static InputParameters scenarioParameters(const InputParameters & parameters);
+
+  /// Reads a scenario table: the parameter names and one row of values per scenario
+  static void readScenarios(const std::string & file_name,
+                            std::vector<std::string> & names,
+                            std::vector<std::vector<std::string>> & rows);
+
+  /// Writes the scenarios and the postprocessor values of the scenarios
+  void writeResults(const std::vector<Real> & values) const;
+
+  /// Scenario table
+  std::vector<std::string> _scenario_names;
+  std::vector<std::vector<std::string>> _scenarios;
+
+  /// Postprocessors collected from each scenario
+  const std::vector<PostprocessorName> _postprocessors;
+};
+
+#endif
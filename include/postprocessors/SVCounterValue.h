@@ -0,0 +1,42 @@
+#ifndef SVCOUNTERVALUE_H
+#define SVCOUNTERVALUE_H
+
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class SVCounterValue;
+
+template <>
+InputParameters validParams<SVCounterValue>();
+
+/**
+ * Reports a counter of the Saint-Venant objects (SVCounters) summed over
+ * every object of a type on every processor: its total since the start of
+ * the run or its increase since the previous execution.
+ */
+class SVCounterValue : public GeneralPostprocessor
+{
+public:
+  SVCounterValue(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual Real getValue() override;
+
+protected:
+  /// Counter name: <type>/<name>
+  const std::string _counter;
+
+  /// Whether the value is the increase since the previous execution
+  const bool _step;
+
+  /// Total on this processor
+  Real _value;
+
+  /// Total over every processor at the previous execution
+  Real _previous;
+};
+
+#endif
@@ -3,8 +3,13 @@
 
 #include "ElementPostprocessor.h"
 
+// Saint-Venant includes
+#include "SVCounters.h"
+
 // Forward Declarations
 class TimeStepCFL;
+class SVGeometryCache;
+class SVWetDryTracker;
 
 template <>
 InputParameters validParams<TimeStepCFL>();
@@ -20,6 +25,19 @@ protected:
   virtual Real getValue();
   virtual void threadJoin(const UserObject & uo);
 
+  // Stable timestep of the current element
+  Real computeElementDt();
+
+  // Stable timestep of the current element for a mesh dimension
+  template <unsigned int dim>
+  Real computeElementDtT();
+
+  // The specialization for the mesh dimension
+  Real (TimeStepCFL::*_compute_element_dt)();
+
+  // Number of times the current element may be refined before the next step
+  unsigned int refinementLevels() const;
+
   // Coupled variables
   const VariableValue & _h;
   const VariableValue & _q_x;
@@ -29,8 +47,27 @@ protected:
   const Real _cfl;
   const Real _g;
 
+  // Cached element geometry (optional)
+  const SVGeometryCache * const _geometry;
+
+  // Wet/dry tracking (optional)
+  const SVWetDryTracker * const _wet_dry;
+
+  // Height under which a quadrature point is dry (0 without wet/dry tracking)
+  const Real _h_dry;
+
+  // Refinement cycles per step and max level (0 without adaptivity)
+  unsigned int _refine_cycles;
+  unsigned int _max_h_level;
+
   // Value used in communication
   Real _value;
+
+  // Counters: calls and time of computeElementDt(), quadrature points visited
+  SVCounters _counters;
+  Real & _calls;
+  Real & _time;
+  Real & _qps;
 };
 
 #endif
@@ -0,0 +1,101 @@
+#ifndef TIMESTEPMULTIRATECFL_H
+#define TIMESTEPMULTIRATECFL_H
+
+#include "TimeStepCFL.h"
+
+#include <unordered_map>
+
+// Forward Declarations
+class TimeStepMultirateCFL;
+
+template <>
+InputParameters validParams<TimeStepMultirateCFL>();
+
+/**
+ * Computes the CFL timestep of every element and bins the elements into
+ * power-of-two rate levels: an element on level l is stable with 2^l times
+ * the smallest timestep dt_min. Neighboring levels differ by at most one.
+ * The value is the macro timestep dt_min 2^L, where L is the highest level,
+ * which SVExplicitSSPRungeKutta (multirate = this object) takes in 2^L
+ * substeps of dt_min.
+ *
+ * On substep k, the residual contributions of the elements on level l are
+ * weighted by 2^l if k is a multiple of 2^l and skipped otherwise, so that
+ * every element contributes exactly one timestep over the macro step.
+ *
+ * The timesteps are stored for the local elements only and the levels for the
+ * local elements and their face neighbors on other processors, whose levels
+ * are exchanged with their owners while the levels are limited.
+ */
+class TimeStepMultirateCFL : public TimeStepCFL
+{
+public:
+  TimeStepMultirateCFL(const InputParameters & parameters);
+
+  virtual void meshChanged() override;
+
+  /// Rate level of a local or ghosted element (0 is updated every substep)
+  unsigned int level(dof_id_type id) const
+  {
+    const auto it = _level.find(id);
+    return it != _level.end() ? it->second : 0;
+  }
+
+  /// CFL timestep of a local element from the last execution
+  Real elementDt(dof_id_type id) const
+  {
+    const auto it = _elem_dt.find(id);
+    return it != _elem_dt.end() ? it->second : 0;
+  }
+
+  /// Number of substeps in a macro step
+  unsigned int substeps() const { return 1u << _max_level_used; }
+
+  /// Weight of the contributions on a level in the current substep (0 if skipped)
+  Real levelWeight(unsigned int level) const;
+
+  /// Weight of the contributions of an element in the current substep
+  Real weight(const Elem * elem) const { return levelWeight(level(elem->id())); }
+
+protected:
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual Real getValue() override;
+  virtual void threadJoin(const UserObject & uo) override;
+
+  /// Bins the elements into levels from _elem_dt and _value
+  void computeLevels();
+
+  /// Lists the local elements that are face neighbors of elements on other processors
+  void buildSendList();
+
+  /// Sends the levels of the local elements to the processors ghosting them
+  void exchangeLevels();
+
+  /// Limits the local levels to one above their neighbors, returns true if any changed
+  bool limitLevels();
+
+  /// Highest allowed level
+  const unsigned int _max_level;
+
+  /// Highest level in use
+  unsigned int _max_level_used;
+
+  /// CFL timestep of the local elements, by element id
+  std::unordered_map<dof_id_type, Real> _elem_dt;
+
+  /// Level of the local elements and of their face neighbors on other processors
+  std::unordered_map<dof_id_type, unsigned char> _level;
+
+  /// Local elements whose level is sent to each neighboring processor
+  std::map<processor_id_type, std::vector<dof_id_type>> _send_list;
+
+  /// Whether or not the send list is up to date with the mesh
+  bool _send_list_built;
+
+  /// Macro timestep
+  Real _macro_dt;
+};
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef SVSCHURPRECONDITIONER_H
+#define SVSCHURPRECONDITIONER_H
+
+#include "FieldSplitPreconditioner.h"
+
+// Forward Declarations
+class SVSchurPreconditioner;
+
+template <>
+InputParameters validParams<SVSchurPreconditioner>();
+
+/**
+ * Block preconditioner for the implicit Saint-Venant equations, which splits
+ * the unknowns into the momentum (q_x, q_y) and the height h and
+ * preconditions the height with the Schur complement of the momentum block.
+ *
+ * The momentum block holds the mass, advection and artificial viscosity
+ * terms and is approximated by its diagonal in the Schur complement
+ * S = A_hh - A_hq diag(A_qq)^-1 A_qh, which is the elliptic gravity wave
+ * operator M / dt - g h dt div(grad) at large timesteps. S is solved with
+ * algebraic multigrid and the momentum block with additive Schwarz, so the
+ * Krylov iterations stay nearly independent of the mesh at CFL numbers well
+ * above one and the preconditioner runs in parallel.
+ *
+ * The splits are created by the preconditioner, so the input only needs the
+ * variables in the Preconditioning block. The Jacobian must be fully coupled.
+ */
+class SVSchurPreconditioner : public FieldSplitPreconditioner
+{
+public:
+  SVSchurPreconditioner(const InputParameters & parameters);
+
+protected:
+  /// Adds a split of the variables vars with the given PETSc options
+  void addVariableSplit(const std::string & split_name,
+                        const std::vector<NonlinearVariableName> & vars,
+                        const std::string & prefix);
+
+  /// Parameters of a new split, attached to the problem
+  InputParameters splitParameters();
+};
+
+#endif
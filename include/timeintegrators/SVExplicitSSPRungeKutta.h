@@ -0,0 +1,74 @@
+#ifndef SVEXPLICITSSPRUNGEKUTTA_H
+#define SVEXPLICITSSPRUNGEKUTTA_H
+
+#include "TimeIntegrator.h"
+#include "MeshChangedInterface.h"
+
+// Forward Declarations
+class SVExplicitSSPRungeKutta;
+class TimeStepMultirateCFL;
+
+template <>
+InputParameters validParams<SVExplicitSSPRungeKutta>();
+
+/**
+ * Explicit strong stability preserving Runge-Kutta time integration (orders
+ * one through three) with a lumped mass matrix. Each stage is a single
+ * evaluation of the non-time residual followed by a diagonal scaling, so
+ * neither the Jacobian nor a linear solve is needed. The lumped mass is
+ * computed at the first step and again only after the mesh changes. Use
+ * solve_type = LINEAR, so that the nonlinear system does not evaluate an
+ * initial residual on top of the stages.
+ *
+ * With multirate (forward Euler only), the step is taken in the substeps
+ * of a TimeStepMultirateCFL postprocessor, in which the Saint-Venant
+ * objects given the same postprocessor only assemble the elements on the
+ * levels that are due.
+ */
+class SVExplicitSSPRungeKutta : public TimeIntegrator, public MeshChangedInterface
+{
+public:
+  SVExplicitSSPRungeKutta(const InputParameters & parameters);
+
+  virtual int order() override { return _order; }
+  virtual void computeTimeDerivatives() override;
+  virtual void solve() override;
+  virtual void postStep(NumericVector<Number> & residual) override;
+
+  /// Recomputes the lumped mass at the next step
+  virtual void meshChanged() override { _mass_computed = false; }
+
+protected:
+  /// Computes the inverse of the row-sum lumped mass matrix into _inverse_mass
+  void computeInverseLumpedMass();
+
+  /// Takes the step in the multirate substeps
+  void solveMultirate(NumericVector<Number> & solution);
+
+  /// Order of the method (also the number of stages)
+  const unsigned int _order;
+
+  /// Shu-Osher coefficients: u^(s+1) = a_s u^n + b_s (u^(s) + dt L(u^(s)))
+  std::vector<Real> _a;
+  std::vector<Real> _b;
+
+  /// Stage times as a fraction of the timestep
+  std::vector<Real> _c;
+
+  /// Whether or not the time residual is being evaluated to build the mass
+  bool _assembling_mass;
+
+  /// Whether or not the lumped mass has been computed
+  bool _mass_computed;
+
+  /// Inverse of the lumped mass matrix
+  NumericVector<Number> & _inverse_mass;
+
+  /// Storage for the non-time residual of each stage
+  NumericVector<Number> & _stage_residual;
+
+  /// Multirate levels (optional), found at the first step
+  const TimeStepMultirateCFL * _multirate;
+};
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef SVDEM_H
+#define SVDEM_H
+
+#include "GeneralUserObject.h"
+
+// Forward Declarations
+class SVDEM;
+
+template <>
+InputParameters validParams<SVDEM>();
+
+/**
+ * Provides the bathymetry b and its gradient from a digital elevation model
+ * (DEM) stored as a tiled binary raster (see scripts/asc2svdem.py). The
+ * raster is memory-mapped read-only, so only the pages of the tiles that are
+ * touched are ever loaded, and b is interpolated bilinearly between the cell
+ * centers. Each rank advises the kernel to load the tiles under its local
+ * elements at setup, and the tile layout keeps the lookups of neighboring
+ * points within a few pages.
+ */
+class SVDEM : public GeneralUserObject
+{
+public:
+  SVDEM(const InputParameters & parameters);
+  virtual ~SVDEM();
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+  /// Bathymetry at a point
+  Real value(const Point & p) const;
+
+  /// Bathymetry at a point, with its gradient in gradient
+  Real value(const Point & p, RealGradient & gradient) const;
+
+protected:
+  /// Value of cell (i, j), counted from the lower-left cell
+  Real cell(std::size_t i, std::size_t j) const
+  {
+    const std::size_t tile = (j / _tile) * _n_tiles_x + i / _tile;
+    return _data[tile * _tile * _tile + (j % _tile) * _tile + i % _tile];
+  }
+
+  /// Lower-left cell index and local coordinate in [0, 1] of x along one axis,
+  /// returns false if x is clamped to the raster (or the axis has one cell)
+  static bool locate(Real x, Real x0, Real dx, std::size_t n, std::size_t & i, Real & s);
+
+  /// Advises the kernel to load the tiles under the local elements
+  void prefetch();
+
+  /// File name of the raster
+  const FileName _file;
+
+  /// File descriptor and mapping of the raster
+  int _fd;
+  void * _map;
+  std::size_t _map_size;
+
+  /// Values of the cells, tile by tile
+  const float * _data;
+
+  /// Number of cells in x and y and cells per tile side
+  std::size_t _nx;
+  std::size_t _ny;
+  std::size_t _tile;
+  std::size_t _n_tiles_x;
+
+  /// Center of the lower-left cell and cell size
+  Real _x0;
+  Real _y0;
+  Real _dx;
+  Real _dy;
+};
+
+#endif
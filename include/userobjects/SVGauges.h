@@ -0,0 +1,147 @@
+#ifndef SVGAUGES_H
+#define SVGAUGES_H
+
+#include "GeneralUserObject.h"
+
+// libMesh includes
+#include "libmesh/point_locator_base.h"
+
+// System includes
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+// Forward Declarations
+class SVGauges;
+class MooseVariable;
+
+template <>
+InputParameters validParams<SVGauges>();
+
+/**
+ * Samples the height and velocity at gauge points and the discharge through
+ * cross-sections every step, and writes them as time series to a CSV or
+ * binary file in place of full field output.
+ *
+ * The gauges and the sample points of the sections are located once (and
+ * again when the mesh changes), and the element and the shape function
+ * values at each point are cached, so each step only reads the solution
+ * at the dofs of those elements. The discharge through a section from start
+ * to end is the integral of q * n along the segment, with n its normal to
+ * the right of the direction from start to end (+x in 1D, in which a section
+ * is the point start). Sample points outside of the mesh do not contribute.
+ *
+ * The rows are stored in a ring buffer on the first processor and written
+ * by a background thread once half of the buffer is full, so the solve only
+ * waits on the file when the buffer is full. The remaining rows are written
+ * when the object is destroyed.
+ *
+ * The binary format is the magic "SVGAUGE1", the number of columns and the
+ * length and name of each column (as uint64 and chars), followed by the rows
+ * of float64 values (all in the native byte order).
+ */
+class SVGauges : public GeneralUserObject
+{
+public:
+  SVGauges(const InputParameters & parameters);
+  virtual ~SVGauges();
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// A point located in a local element, with the shape function values at the point
+  struct Sample
+  {
+    /// Element that contains the point
+    const Elem * elem;
+
+    /// Shape function values at the point
+    std::vector<Real> phi;
+
+    /// Gauge or section index
+    unsigned int index;
+
+    /// Length of the section that the point represents times its normal (sections only)
+    RealVectorValue weighted_normal;
+  };
+
+  /// Locates the gauges and the sample points of the sections
+  void locate();
+
+  /// Adds the sample at p to samples if it is in a local element, returns whether it was found
+  bool addSample(const PointLocatorBase & locator,
+                 const Point & p,
+                 unsigned int index,
+                 const RealVectorValue & weighted_normal,
+                 std::vector<Sample> & samples);
+
+  /// Value of a variable at a sample point
+  Real value(const Sample & sample,
+             const MooseVariable & var,
+             const NumericVector<Number> & solution);
+
+  /// Column names of the output
+  std::vector<std::string> columnNames() const;
+
+  /// Stores a row in the ring buffer, waiting for the writer if it is full
+  void push(const std::vector<Real> & row);
+
+  /// Writes the rows of the ring buffer until the object is destroyed
+  void writeRows();
+
+  /// Coupled variables
+  MooseVariable & _h_var;
+  MooseVariable & _q_x_var;
+  MooseVariable * const _q_y_var;
+
+  /// Gauge points and names
+  const std::vector<Point> _gauges;
+  std::vector<std::string> _gauge_names;
+
+  /// Cross-sections: end points, names and sample points per section
+  const std::vector<Point> _section_start;
+  const std::vector<Point> _section_end;
+  std::vector<std::string> _section_names;
+  const unsigned int _section_samples;
+
+  /// Height under which the velocity is zero
+  const Real _h_dry;
+
+  /// Number of steps between samples
+  const unsigned int _interval;
+
+  /// Whether or not the output is binary
+  const bool _binary;
+
+  /// Local gauges and section sample points
+  std::vector<Sample> _gauge_samples;
+  std::vector<Sample> _section_sample_points;
+
+  /// Dof indices of the current sample
+  std::vector<dof_id_type> _dof_indices;
+
+  /// Number of columns of a row, including the time
+  const unsigned int _n_columns;
+
+  /// Ring buffer of rows (first processor only), with the number of rows
+  /// that have been pushed and written
+  std::vector<Real> _buffer;
+  const std::size_t _capacity;
+  std::size_t _pushed;
+  std::size_t _written;
+
+  /// Output file and the thread that writes to it
+  std::ofstream _file;
+  std::thread _writer;
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  bool _done;
+};
+
+#endif
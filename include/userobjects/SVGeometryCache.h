@@ -0,0 +1,57 @@
+#ifndef SVGEOMETRYCACHE_H
+#define SVGEOMETRYCACHE_H
+
+#include "GeneralUserObject.h"
+
+// libMesh includes
+#include "libmesh/elem.h"
+
+// Forward Declarations
+class SVGeometryCache;
+class MooseMesh;
+
+template <>
+InputParameters validParams<SVGeometryCache>();
+
+/**
+ * Stores the characteristic length and a boundary node mask for every
+ * element, indexed by element id. Built at setup and rebuilt only
+ * when the mesh changes.
+ */
+class SVGeometryCache : public GeneralUserObject
+{
+public:
+  SVGeometryCache(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+  /// Characteristic length of an element: volume^(1 / dim)
+  static Real characteristicLength(const Elem * elem);
+
+  /// Cached characteristic length of an element
+  Real length(const Elem * elem) const { return _length[elem->id()]; }
+
+  /// Mask with bit i set if node i of an element is on the boundary
+  static unsigned int boundaryNodeMask(const MooseMesh & mesh, const Elem * elem);
+
+  /// Cached boundary node mask of an element
+  unsigned int boundaryNodes(const Elem * elem) const { return _boundary_nodes[elem->id()]; }
+
+  /// Whether or not any node of an element is on the boundary
+  bool onBoundary(const Elem * elem) const { return _boundary_nodes[elem->id()] != 0; }
+
+protected:
+  /// Fills the cache for every active element
+  void build();
+
+  /// Per-element data indexed by element id
+  std::vector<Real> _length;
+  std::vector<unsigned int> _boundary_nodes;
+};
+
+#endif
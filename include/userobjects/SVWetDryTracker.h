@@ -0,0 +1,87 @@
+#ifndef SVWETDRYTRACKER_H
+#define SVWETDRYTRACKER_H
+
+#include "GeneralUserObject.h"
+
+// libMesh includes
+#include "libmesh/elem.h"
+
+// Forward Declarations
+class SVWetDryTracker;
+class MooseVariable;
+
+template <>
+InputParameters validParams<SVWetDryTracker>();
+
+/**
+ * Tracks the set of active elements: those that are wet (any node with a
+ * height above h_dry) plus a halo of neighboring elements so that the front
+ * can advance within a timestep. Saint-Venant objects given this user object
+ * skip inactive (dry) elements, and treat the quadrature points of the halo
+ * where the height is at most h_dry as dry (no velocity).
+ *
+ * A processor whose part of the mesh is mostly dry does little work. With
+ * imbalance_threshold, the mesh is repartitioned when the ratio of the
+ * maximum to the mean number of active elements per processor exceeds the
+ * threshold: the active elements are given a larger weight than the dry ones
+ * (the Metis and Parmetis partitioners honour per-element weights) before the
+ * mesh is partitioned and the problem updated as after an adaptivity step.
+ */
+class SVWetDryTracker : public GeneralUserObject
+{
+public:
+  SVWetDryTracker(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override {}
+  virtual void execute() override;
+
+  /// The element ids change with adaptivity: update on the new mesh
+  virtual void meshChanged() override;
+  virtual void finalize() override {}
+
+  /// Whether or not an element is wet or in the halo (elements not yet tracked are active)
+  bool isActive(const Elem * elem) const
+  {
+    return elem->id() >= _active.size() || _active[elem->id()];
+  }
+
+  /// Height under which a node is considered dry
+  Real hDry() const { return _h_dry; }
+
+protected:
+  /// Adds the neighbors of the active elements to the active set
+  void addHaloLayer();
+
+  /// Ratio of the maximum to the mean number of active elements per processor
+  Real computeImbalance() const;
+
+  /// Repartitions the mesh with the active elements weighted and updates the problem
+  void repartition();
+
+  /// The height variable
+  MooseVariable & _h_var;
+
+  /// Height under which a node is considered dry
+  const Real _h_dry;
+
+  /// Number of neighbor layers added around the wet elements
+  const unsigned int _halo_layers;
+
+  /// Imbalance over which the mesh is repartitioned (0 to disable)
+  const Real _imbalance_threshold;
+
+  /// Partitioner weight of an active element, relative to a dry element
+  const unsigned int _active_weight;
+
+  /// Whether or not the problem is being updated after a repartition
+  bool _repartitioning;
+
+  /// Active flags indexed by element id
+  std::vector<unsigned char> _active;
+
+  /// Scratch storage for adding the halo
+  std::vector<unsigned char> _halo;
+};
+
+#endif
@@ -0,0 +1,95 @@
+#ifndef SVCOUNTERS_H
+#define SVCOUNTERS_H
+
+#include "MooseTypes.h"
+
+// Saint-Venant includes
+#include "SVConfig.h"
+
+// System includes
+#include <chrono>
+#include <map>
+#include <set>
+#include <string>
+
+/**
+ * Counters of a Saint-Venant object (calls, quadrature points visited,
+ * Newton iterations, warnings, time spent in a section...), registered for
+ * the lifetime of the object so that SVCounterValue can report the total of
+ * a counter "<type>/<name>" over every object of that type on a processor.
+ *
+ * MOOSE builds one object per thread, so the counters of an object are only
+ * ever written by one thread and are plain values: incrementing them costs
+ * no more than an addition. The counters are created in the constructor of
+ * the object, and the references that counter() returns stay valid.
+ *
+ * The timed sections (two clock reads per call, and the performance log
+ * when it is enabled) are only compiled in with SV_TIMED_SECTIONS, which
+ * "make SV_TIMED_SECTIONS=yes" defines in the generated header SVConfig.h:
+ * otherwise a section only counts its calls, and the time counters stay at
+ * zero.
+ */
+class SVCounters
+{
+public:
+  SVCounters(const std::string & type);
+  ~SVCounters();
+
+  SVCounters(const SVCounters &) = delete;
+  SVCounters & operator=(const SVCounters &) = delete;
+
+  /// Counter name of the object, created at 0 on the first call
+  Real & counter(const std::string & name);
+
+  /// Type of the object, which is also the header of its performance log sections
+  const char * type() const { return _type; }
+
+  /// Sum of the counter "<type>/<name>" over the objects on this processor
+  static Real total(const std::string & counter);
+
+  /// Names "<type>/<name>" of the counters on this processor
+  static std::set<std::string> names();
+
+  /// Whether or not the sections are timed (built with SV_TIMED_SECTIONS)
+  static constexpr bool timedSections()
+  {
+#ifdef SV_TIMED_SECTIONS
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  /**
+   * Counts a call. With SV_TIMED_SECTIONS, also counts its time and logs it
+   * in the performance log under the type of the object and label (a string
+   * literal) when there is a single thread, as the libMesh performance log
+   * is not thread safe.
+   */
+  class Section
+  {
+  public:
+#ifdef SV_TIMED_SECTIONS
+    Section(const SVCounters & counters, const char * label, Real & calls, Real & time);
+    ~Section();
+
+  private:
+    const char * const _header;
+    const char * const _label;
+    Real & _time;
+    const bool _log;
+    const std::chrono::steady_clock::time_point _start;
+#else
+    Section(const SVCounters &, const char *, Real & calls, Real &) { ++calls; }
+#endif
+  };
+
+private:
+  /// Type of the object (one string per type, shared by its objects)
+  const char * _type;
+
+  /// Counters of the object by name (nodes, which do not move)
+  std::map<std::string, Real> _counters;
+};
+
+#endif
@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""Converts an ESRI ASCII grid (.asc) into the tiled binary raster read by SVDEM.
+
+The ASCII grid is streamed one band of tile rows at a time, so that the
+conversion of large terrain models does not need the whole grid in memory.
+
+Layout of the output (little-endian):
+  - a header padded to HEADER_SIZE bytes:
+      char[8]   magic "SVDEM1"
+      uint64[3] number of cells in x and y, tile size (cells per tile side)
+      float64[4] center of the lower-left cell (x, y) and cell size (x, y)
+  - the tiles in row-major order starting from the lower-left tile, each
+    holding tile * tile float32 values in row-major order starting from its
+    lower-left cell; the tiles on the upper and right edges are padded by
+    repeating the last row and column.
+
+Usage:
+  asc2svdem.py input.asc output.svdem [--tile 64] [--nodata-fill VALUE]
+               [--scale 1] [--offset 0]
+
+The values that are written are scale * elevation + offset, which can be used
+to convert elevations into the bathymetry b of the Saint-Venant equations.
+"""
+
+import argparse
+import array
+import struct
+import sys
+
+MAGIC = b"SVDEM1\0\0"
+HEADER_SIZE = 4096
+
+
+def read_header(stream):
+    """Reads the ESRI ASCII grid header and returns it as a dict."""
+    header = {}
+    keys = ("ncols", "nrows", "xllcorner", "yllcorner", "xllcenter", "yllcenter",
+            "cellsize", "dx", "dy", "nodata_value")
+    while True:
+        position = stream.tell()
+        line = stream.readline()
+        fields = line.split()
+        if not fields or fields[0].lower() not in keys:
+            stream.seek(position)
+            break
+        header[fields[0].lower()] = float(fields[1])
+
+    for key in ("ncols", "nrows"):
+        if key not in header:
+            sys.exit("asc2svdem: missing %s in the grid header" % key)
+
+    dx = header.get("dx", header.get("cellsize"))
+    dy = header.get("dy", header.get("cellsize"))
+    if dx is None or dy is None:
+        sys.exit("asc2svdem: missing cellsize in the grid header")
+
+    # Center of the lower-left cell
+    if "xllcenter" in header:
+        x0 = header["xllcenter"]
+    else:
+        x0 = header.get("xllcorner", 0.0) + 0.5 * dx
+    if "yllcenter" in header:
+        y0 = header["yllcenter"]
+    else:
+        y0 = header.get("yllcorner", 0.0) + 0.5 * dy
+
+    return {"nx": int(header["ncols"]), "ny": int(header["nrows"]), "x0": x0, "y0": y0,
+            "dx": dx, "dy": dy, "nodata": header.get("nodata_value")}
+
+
+def values(stream):
+    """Yields the values of the grid one at a time."""
+    for line in stream:
+        for field in line.split():
+            yield float(field)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="the ESRI ASCII grid")
+    parser.add_argument("output", help="the tiled raster for SVDEM")
+    parser.add_argument("--tile", type=int, default=64,
+                        help="cells per tile side (a multiple of 32 keeps the tiles "
+                        "page aligned)")
+    parser.add_argument("--nodata-fill", type=float, default=None,
+                        help="the value that replaces the no data cells (an error is "
+                        "raised on no data cells if not given)")
+    parser.add_argument("--scale", type=float, default=1.0,
+                        help="the factor applied to every value")
+    parser.add_argument("--offset", type=float, default=0.0,
+                        help="the offset added to every scaled value")
+    args = parser.parse_args()
+
+    if args.tile <= 0:
+        sys.exit("asc2svdem: the tile size must be positive")
+
+    with open(args.input, "r") as stream, open(args.output, "wb") as out:
+        grid = read_header(stream)
+        nx, ny, tile = grid["nx"], grid["ny"], args.tile
+        ntx = (nx + tile - 1) // tile
+        nty = (ny + tile - 1) // tile
+        tile_bytes = 4 * tile * tile
+
+        header = MAGIC + struct.pack("<3Q4d", nx, ny, tile, grid["x0"], grid["y0"],
+                                     grid["dx"], grid["dy"])
+        out.write(header + b"\0" * (HEADER_SIZE - len(header)))
+        out.truncate(HEADER_SIZE + ntx * nty * tile_bytes)
+
+        source = values(stream)
+
+        def read_row():
+            row = array.array("f")
+            for _ in range(nx):
+                try:
+                    value = next(source)
+                except StopIteration:
+                    sys.exit("asc2svdem: the grid has fewer values than ncols * nrows")
+                if grid["nodata"] is not None and value == grid["nodata"]:
+                    if args.nodata_fill is None:
+                        sys.exit("asc2svdem: no data cell found (use --nodata-fill)")
+                    value = args.nodata_fill
+                else:
+                    value = args.scale * value + args.offset
+                row.append(value)
+            # Pad the right edge by repeating the last column
+            row.extend([row[-1]] * (ntx * tile - nx))
+            return row
+
+        # The ASCII rows go from north to south: fill the bands of tile rows
+        # from the top, padding the top band by repeating its last row
+        for ty in reversed(range(nty)):
+            band_rows = min(tile, ny - ty * tile)
+            band = [None] * tile
+            for j in reversed(range(band_rows)):
+                band[j] = read_row()
+            for j in range(band_rows, tile):
+                band[j] = band[band_rows - 1]
+
+            for tx in range(ntx):
+                data = array.array("f")
+                for j in range(tile):
+                    data.extend(band[j][tx * tile:(tx + 1) * tile])
+                if sys.byteorder != "little":
+                    data.byteswap()
+                out.seek(HEADER_SIZE + (ty * ntx + tx) * tile_bytes)
+                out.write(data.tobytes())
+
+
+if __name__ == "__main__":
+    main()
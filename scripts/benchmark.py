@@ -0,0 +1,244 @@
+#!/usr/bin/env python3
+"""Scaling benchmarks of the shallowwater app with regression tracking.
+
+Runs parameterized versions of the 2D faux dam break and of the LeVeque and
+SWASHES 1D examples over a range of mesh sizes, MPI rank counts and thread
+counts, and records for each run the time spent in the residual and Jacobian
+evaluations, the nonlinear and linear iterations, the peak memory and the
+wall time in a JSON report. A report can be compared against a stored
+baseline with a relative tolerance.
+
+Each run copies the example input with extra postprocessors that measure the
+run (PerformanceData, cumulative iteration counts and MemoryUsage), and sets
+the mesh size, the number of steps and the outputs on the command line.
+
+Usage:
+  benchmark.py run --exec ./shallowwater-opt [--cases ...] [--sizes 100 200 ...]
+                   [--ranks 1 2 4] [--threads 1 2] [--scaling strong|weak]
+                   [--steps 20] [--output benchmark.json]
+  benchmark.py compare benchmark.json baseline.json [--tolerance 0.1]
+
+In strong scaling, every size runs on every rank and thread count. In weak
+scaling, the number of elements grows with the number of ranks from each
+size, which is then the size on one rank.
+"""
+
+import argparse
+import csv
+import json
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+
+# Input and dimension of each case; a size n runs n^2 elements in 2D and in 1D
+CASES = {
+    "2d-faux-dam-break": ("examples/2d-faux-dam-break.i", 2),
+    "leveque-1d-dam-break": ("examples/leveque/leveque-1d-dam-break.i", 1),
+    "swashes-1d-lake-rest-immersed-bump": (
+        "examples/swashes/swashes-1d-lake-rest-immersed-bump.i", 1),
+}
+
+# Postprocessors that measure a run
+POSTPROCESSORS = """
+  [./benchmark_residual_time]
+    type = PerformanceData
+    event = compute_residual()
+    column = total_time
+  [../]
+
+  [./benchmark_jacobian_time]
+    type = PerformanceData
+    event = compute_jacobian()
+    column = total_time
+  [../]
+
+  [./benchmark_nonlinear_step]
+    type = NumNonlinearIterations
+    outputs = none
+  [../]
+
+  [./benchmark_linear_step]
+    type = NumLinearIterations
+    outputs = none
+  [../]
+
+  [./benchmark_nonlinear_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = benchmark_nonlinear_step
+  [../]
+
+  [./benchmark_linear_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = benchmark_linear_step
+  [../]
+
+  [./benchmark_memory]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+  [../]
+"""
+
+# Report fields and the postprocessors that measure them
+METRICS = {
+    "residual_time": "benchmark_residual_time",
+    "jacobian_time": "benchmark_jacobian_time",
+    "nonlinear_its": "benchmark_nonlinear_its",
+    "linear_its": "benchmark_linear_its",
+    "memory": "benchmark_memory",
+}
+
+
+def benchmark_input(case, directory):
+    """Writes the input of a case with the benchmark postprocessors and returns its path."""
+    with open(os.path.join(ROOT, CASES[case][0])) as stream:
+        text = stream.read()
+
+    if "[Postprocessors]" in text:
+        text = text.replace("[Postprocessors]", "[Postprocessors]" + POSTPROCESSORS, 1)
+    else:
+        text += "\n[Postprocessors]" + POSTPROCESSORS + "[]\n"
+
+    path = os.path.join(directory, case + ".i")
+    with open(path, "w") as stream:
+        stream.write(text)
+    return path
+
+
+def run(args, case, size, ranks, threads, directory):
+    """Runs one benchmark and returns its record."""
+    dim = CASES[case][1]
+    elements = size * size
+    mesh = ["Mesh/nx=%d" % size, "Mesh/ny=%d" % size] if dim == 2 else ["Mesh/nx=%d" % elements]
+
+    file_base = os.path.join(directory, "%s_%d_%d_%d" % (case, size, ranks, threads))
+    command = [args.mpiexec, "-n", str(ranks)] if ranks > 1 else []
+    command += [args.exec, "-i", benchmark_input(case, directory), "--n-threads=%d" % threads]
+    command += mesh
+    command += ["Executioner/num_steps=%d" % args.steps, "Executioner/end_time=1e30",
+                "Outputs/exodus=false", "Outputs/csv=true", "Outputs/file_base=" + file_base]
+
+    start = time.time()
+    result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                            universal_newlines=True)
+    wall_time = time.time() - start
+
+    record = {"case": case, "size": size, "elements": elements, "ranks": ranks,
+              "threads": threads, "wall_time": wall_time, "status": result.returncode}
+    if result.returncode != 0:
+        sys.stderr.write("benchmark: %s failed:\n%s\n" % (" ".join(command), result.stdout[-4000:]))
+        return record
+
+    # The last row of the postprocessor CSV holds the values at the end of the run
+    with open(file_base + ".csv") as stream:
+        rows = list(csv.DictReader(stream))
+    for field, postprocessor in METRICS.items():
+        record[field] = float(rows[-1][postprocessor]) if rows else None
+    return record
+
+
+def run_all(args):
+    """Runs every benchmark and writes the report."""
+    records = []
+    with tempfile.TemporaryDirectory() as directory:
+        for case in args.cases:
+            for size in args.sizes:
+                for ranks in args.ranks:
+                    # Weak scaling: size^2 elements per rank
+                    scaled = size
+                    if args.scaling == "weak":
+                        scaled = int(round(size * ranks ** 0.5))
+                    for threads in args.threads:
+                        record = run(args, case, scaled, ranks, threads, directory)
+                        record["scaling"] = args.scaling
+                        records.append(record)
+                        print("%-36s %6d^2 ranks %3d threads %3d: %8.2f s" %
+                              (case, scaled, ranks, threads, record["wall_time"]))
+
+    report = {"created": time.strftime("%Y-%m-%dT%H:%M:%S"), "steps": args.steps,
+              "records": records}
+    with open(args.output, "w") as stream:
+        json.dump(report, stream, indent=2)
+    print("benchmark: report written to %s" % args.output)
+
+    return 0 if all(record["status"] == 0 for record in records) else 1
+
+
+def key(record):
+    return (record["case"], record["elements"], record["ranks"], record["threads"])
+
+
+def compare(args):
+    """Compares a report against a baseline and returns nonzero on regressions."""
+    with open(args.report) as stream:
+        report = {key(record): record for record in json.load(stream)["records"]}
+    with open(args.baseline) as stream:
+        baseline = {key(record): record for record in json.load(stream)["records"]}
+
+    regressions = 0
+    for run_key in sorted(set(report) & set(baseline)):
+        new, old = report[run_key], baseline[run_key]
+        for field in list(METRICS) + ["wall_time"]:
+            new_value, old_value = new.get(field), old.get(field)
+            if new_value is None or old_value is None:
+                continue
+
+            # Times below the timer resolution are not compared
+            if field.endswith("time") and max(new_value, old_value) < args.min_time:
+                continue
+
+            if new_value > old_value * (1 + args.tolerance) + 1e-12:
+                regressions += 1
+                print("REGRESSION %s %s: %g -> %g (%+.1f%%)" %
+                      (" ".join(str(k) for k in run_key), field, old_value, new_value,
+                       100 * (new_value / old_value - 1) if old_value else float("inf")))
+
+    missing = sorted(set(baseline) - set(report))
+    for run_key in missing:
+        print("MISSING %s" % " ".join(str(k) for k in run_key))
+
+    print("benchmark: %d runs compared, %d regressions, %d missing" %
+          (len(set(report) & set(baseline)), regressions, len(missing)))
+    return 1 if regressions or missing else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    commands = parser.add_subparsers(dest="command")
+
+    run_parser = commands.add_parser("run", help="run the benchmarks")
+    run_parser.add_argument("--exec", required=True, help="the shallowwater executable")
+    run_parser.add_argument("--mpiexec", default="mpiexec", help="the MPI launcher")
+    run_parser.add_argument("--cases", nargs="+", default=sorted(CASES), choices=sorted(CASES))
+    run_parser.add_argument("--sizes", nargs="+", type=int, default=[100, 200, 400, 800, 1600],
+                            help="the sizes n of the n^2-element meshes")
+    run_parser.add_argument("--ranks", nargs="+", type=int, default=[1])
+    run_parser.add_argument("--threads", nargs="+", type=int, default=[1])
+    run_parser.add_argument("--scaling", choices=["strong", "weak"], default="strong")
+    run_parser.add_argument("--steps", type=int, default=20, help="the number of time steps")
+    run_parser.add_argument("--output", default="benchmark.json", help="the report")
+
+    compare_parser = commands.add_parser("compare", help="compare a report against a baseline")
+    compare_parser.add_argument("report")
+    compare_parser.add_argument("baseline")
+    compare_parser.add_argument("--tolerance", type=float, default=0.1,
+                                help="the relative increase that is a regression")
+    compare_parser.add_argument("--min-time", type=float, default=0.05,
+                                help="the time (s) under which times are not compared")
+
+    args = parser.parse_args()
+    if args.command == "run":
+        args.exec = os.path.abspath(args.exec)
+        return run_all(args)
+    if args.command == "compare":
+        return compare(args)
+    parser.print_help()
+    return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
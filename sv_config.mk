@@ -0,0 +1,27 @@
+###############################################################################
+# Build configuration of the Saint-Venant objects, included by the application
+# and unit Makefiles so that both build the objects the same way.
+#
+# SV_TIMED_SECTIONS - Timed sections of the Saint-Venant objects (SVCounters),
+#                     off by default as they read the clock twice per call:
+#                     make SV_TIMED_SECTIONS=yes
+#
+# The configuration is written to the generated header
+# include/utils/SVConfig.h, which is only rewritten when it changes: the
+# objects that include it (through SVCounters.h) depend on it and are rebuilt
+# when the configuration changes.
+###############################################################################
+SV_TIMED_SECTIONS  ?= no
+
+sv_config_header   := $(dir $(lastword $(MAKEFILE_LIST)))include/utils/SVConfig.h
+
+ifeq ($(SV_TIMED_SECTIONS),yes)
+  sv_config_timed  := \#define SV_TIMED_SECTIONS
+else
+  sv_config_timed  := /* \#undef SV_TIMED_SECTIONS */
+endif
+
+sv_config_content  := // Generated by sv_config.mk: do not edit\n\#ifndef SVCONFIG_H\n\#define SVCONFIG_H\n$(sv_config_timed)\n\#endif\n
+
+$(shell printf '$(sv_config_content)' | cmp -s - $(sv_config_header) || \
+  printf '$(sv_config_content)' > $(sv_config_header))
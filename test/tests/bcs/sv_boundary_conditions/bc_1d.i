@@ -0,0 +1,186 @@
+# Boundary conditions of the Saint-Venant equations in 1D: an imposed
+# discharge on the left and an imposed height on the right (or walls on both
+# sides with BCs/active='h_wall q_wall'). The regime at the boundaries is set
+# by the initial state h0 (1 + 0.1 sin(x)), q0 (1 + 0.1 cos(x)): fluvial by
+# default, torrential with h0 = 0.1 and q0 = +-1. There is no artificial
+# viscosity, whose frozen kappa would spoil the Jacobian check.
+
+[GlobalParams]
+  g = 9.81
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 20
+  xmin = 0
+  xmax = 10
+[]
+
+[Functions]
+  [./initial_height]
+    type = ParsedFunction
+    value = 'h0 * (1 + 0.1 * sin(x))'
+    vars = 'h0'
+    vals = '1'
+  [../]
+
+  [./initial_discharge]
+    type = ParsedFunction
+    value = 'q0 * (1 + 0.1 * cos(x))'
+    vars = 'q0'
+    vals = '0.5'
+  [../]
+[]
+
+[Variables]
+  [./h]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_height
+    [../]
+  [../]
+
+  [./q]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_discharge
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./h_time_derivative]
+    type = TimeDerivative
+    variable = h
+  [../]
+
+  [./h_continuity]
+    type = SVContinuity
+    variable = h
+    q_x = q
+  [../]
+
+  [./q_time_derivative]
+    type = TimeDerivative
+    variable = q
+  [../]
+
+  [./q_advection]
+    type = SVAdvection
+    variable = q
+    h = h
+    q_x = q
+    component = x
+  [../]
+
+  [./q_pressure]
+    type = SVPressure
+    variable = q
+    h = h
+    component = x
+  [../]
+[]
+
+[Materials]
+  [./inflow]
+    type = SVBoundaryState
+    boundary = left
+    imposed = DISCHARGE
+    h = h
+    q_x = q
+    h_imposed = 0.12
+    q_imposed = 0.4
+  [../]
+
+  [./outflow]
+    type = SVBoundaryState
+    boundary = right
+    imposed = HEIGHT
+    h = h
+    q_x = q
+    h_imposed = 1.1
+    q_imposed = 0.8
+  [../]
+[]
+
+[BCs]
+  active = 'h_left q_left h_right q_right'
+
+  [./h_left]
+    type = ImposedDischargeBC
+    variable = h
+    boundary = left
+    equation = CONTINUITY
+  [../]
+
+  [./q_left]
+    type = ImposedDischargeBC
+    variable = q
+    boundary = left
+    equation = MOMENTUM
+    component = x
+    h = h
+    q_x = q
+  [../]
+
+  [./h_right]
+    type = ImposedHeightBC
+    variable = h
+    boundary = right
+    equation = CONTINUITY
+    h = h
+    q_x = q
+  [../]
+
+  [./q_right]
+    type = ImposedHeightBC
+    variable = q
+    boundary = right
+    equation = MOMENTUM
+    component = x
+    h = h
+    q_x = q
+  [../]
+
+  [./h_wall]
+    type = SolidWallBC
+    variable = h
+    boundary = 'left right'
+    equation = CONTINUITY
+    h = h
+  [../]
+
+  [./q_wall]
+    type = SolidWallBC
+    variable = q
+    boundary = 'left right'
+    equation = MOMENTUM
+    component = x
+    h = h
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-12
+
+  dt = 0.05
+  num_steps = 5
+[]
@@ -0,0 +1,289 @@
+# Boundary conditions of the Saint-Venant equations in 2D: an imposed
+# discharge on the left, an imposed height on the right and walls on the top
+# and bottom (or walls everywhere with BCs/active='h_wall q_x_wall q_y_wall').
+# The regime at the left and right boundaries is set by the initial state
+# h0 (1 + 0.1 sin(x + y)), q0 (1 + 0.1 cos(x)) and a small transverse
+# momentum: fluvial by default, torrential with h0 = 0.1 and q0 = +-1. There
+# is no artificial viscosity, whose frozen kappa would spoil the Jacobian
+# check.
+
+[GlobalParams]
+  g = 9.81
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 4
+  xmax = 10
+  ymax = 2
+[]
+
+[Functions]
+  [./initial_height]
+    type = ParsedFunction
+    value = 'h0 * (1 + 0.1 * sin(x + y))'
+    vars = 'h0'
+    vals = '1'
+  [../]
+
+  [./initial_discharge_x]
+    type = ParsedFunction
+    value = 'q0 * (1 + 0.1 * cos(x))'
+    vars = 'q0'
+    vals = '0.5'
+  [../]
+
+  [./initial_discharge_y]
+    type = ParsedFunction
+    value = '0.05 * sin(x) * sin(3.14159 * y / 2)'
+  [../]
+[]
+
+[Variables]
+  [./h]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_height
+    [../]
+  [../]
+
+  [./q_x]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_discharge_x
+    [../]
+  [../]
+
+  [./q_y]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_discharge_y
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./h_time_derivative]
+    type = TimeDerivative
+    variable = h
+  [../]
+
+  [./h_continuity]
+    type = SVContinuity
+    variable = h
+    q_x = q_x
+    q_y = q_y
+  [../]
+
+  [./q_x_time_derivative]
+    type = TimeDerivative
+    variable = q_x
+  [../]
+
+  [./q_x_advection]
+    type = SVAdvection
+    variable = q_x
+    component = x
+    h = h
+    q_x = q_x
+    q_y = q_y
+  [../]
+
+  [./q_x_pressure]
+    type = SVPressure
+    variable = q_x
+    component = x
+    h = h
+  [../]
+
+  [./q_y_time_derivative]
+    type = TimeDerivative
+    variable = q_y
+  [../]
+
+  [./q_y_advection]
+    type = SVAdvection
+    variable = q_y
+    component = y
+    h = h
+    q_x = q_x
+    q_y = q_y
+  [../]
+
+  [./q_y_pressure]
+    type = SVPressure
+    variable = q_y
+    component = y
+    h = h
+  [../]
+[]
+
+[Materials]
+  [./inflow]
+    type = SVBoundaryState
+    boundary = left
+    imposed = DISCHARGE
+    h = h
+    q_x = q_x
+    q_y = q_y
+    h_imposed = 0.12
+    q_imposed = 0.4
+  [../]
+
+  [./outflow]
+    type = SVBoundaryState
+    boundary = right
+    imposed = HEIGHT
+    h = h
+    q_x = q_x
+    q_y = q_y
+    h_imposed = 1.1
+    q_imposed = 0.8
+  [../]
+[]
+
+[BCs]
+  active = 'h_left q_x_left q_y_left h_right q_x_right q_y_right
+            h_side q_x_side q_y_side'
+
+  [./h_left]
+    type = ImposedDischargeBC
+    variable = h
+    boundary = left
+    equation = CONTINUITY
+  [../]
+
+  [./q_x_left]
+    type = ImposedDischargeBC
+    variable = q_x
+    boundary = left
+    equation = MOMENTUM
+    component = x
+    h = h
+    q_x = q_x
+    q_y = q_y
+  [../]
+
+  [./q_y_left]
+    type = ImposedDischargeBC
+    variable = q_y
+    boundary = left
+    equation = MOMENTUM
+    component = y
+    h = h
+    q_x = q_x
+    q_y = q_y
+  [../]
+
+  [./h_right]
+    type = ImposedHeightBC
+    variable = h
+    boundary = right
+    equation = CONTINUITY
+    h = h
+    q_x = q_x
+    q_y = q_y
+  [../]
+
+  [./q_x_right]
+    type = ImposedHeightBC
+    variable = q_x
+    boundary = right
+    equation = MOMENTUM
+    component = x
+    h = h
+    q_x = q_x
+    q_y = q_y
+  [../]
+
+  [./q_y_right]
+    type = ImposedHeightBC
+    variable = q_y
+    boundary = right
+    equation = MOMENTUM
+    component = y
+    h = h
+    q_x = q_x
+    q_y = q_y
+  [../]
+
+  [./h_side]
+    type = SolidWallBC
+    variable = h
+    boundary = 'top bottom'
+    equation = CONTINUITY
+    h = h
+  [../]
+
+  [./q_x_side]
+    type = SolidWallBC
+    variable = q_x
+    boundary = 'top bottom'
+    equation = MOMENTUM
+    component = x
+    h = h
+  [../]
+
+  [./q_y_side]
+    type = SolidWallBC
+    variable = q_y
+    boundary = 'top bottom'
+    equation = MOMENTUM
+    component = y
+    h = h
+  [../]
+
+  [./h_wall]
+    type = SolidWallBC
+    variable = h
+    boundary = 'left right top bottom'
+    equation = CONTINUITY
+    h = h
+  [../]
+
+  [./q_x_wall]
+    type = SolidWallBC
+    variable = q_x
+    boundary = 'left right top bottom'
+    equation = MOMENTUM
+    component = x
+    h = h
+  [../]
+
+  [./q_y_wall]
+    type = SolidWallBC
+    variable = q_y
+    boundary = 'left right top bottom'
+    equation = MOMENTUM
+    component = y
+    h = h
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-12
+
+  dt = 0.05
+  num_steps = 5
+[]
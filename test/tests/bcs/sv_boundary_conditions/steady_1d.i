@@ -0,0 +1,189 @@
+# A reach of length 100 without bathymetry, initially at rest with h = 1,
+# with an imposed inflow discharge of 0.5 on the left and an imposed height
+# of 1 on the right, which SVBoundaryState computes the boundary states for.
+# The flow settles to the uniform state h = 1, q = 0.5, which is an exact
+# steady state of the discretization and the one that the boundary
+# conditions reached when they computed the boundary states themselves.
+
+[GlobalParams]
+  g = 9.80665
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 50
+  xmin = 0
+  xmax = 100
+[]
+
+[Variables]
+  [./h]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = ConstantIC
+      value = 1
+    [../]
+  [../]
+
+  [./q]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./h_time_derivative]
+    type = TimeDerivative
+    variable = h
+  [../]
+
+  [./h_continuity]
+    type = SVContinuity
+    variable = h
+    q_x = q
+  [../]
+
+  [./h_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = h
+  [../]
+
+  [./q_time_derivative]
+    type = TimeDerivative
+    variable = q
+  [../]
+
+  [./q_advection]
+    type = SVAdvection
+    variable = q
+    h = h
+    q_x = q
+    component = x
+  [../]
+
+  [./q_pressure]
+    type = SVPressure
+    variable = q
+    h = h
+    component = x
+  [../]
+
+  [./q_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = q
+  [../]
+[]
+
+[Materials]
+  [./sv_material]
+    type = SVMaterial
+    viscosity_type = FIRST_ORDER
+    h = h
+    q_x = q
+  [../]
+
+  [./inflow]
+    type = SVBoundaryState
+    boundary = left
+    imposed = DISCHARGE
+    h = h
+    q_x = q
+    h_imposed = 1
+    q_imposed = 0.5
+  [../]
+
+  [./outflow]
+    type = SVBoundaryState
+    boundary = right
+    imposed = HEIGHT
+    h = h
+    q_x = q
+    h_imposed = 1
+    q_imposed = 0
+  [../]
+[]
+
+[BCs]
+  [./h_left]
+    type = ImposedDischargeBC
+    variable = h
+    boundary = left
+    equation = CONTINUITY
+  [../]
+
+  [./q_left]
+    type = ImposedDischargeBC
+    variable = q
+    boundary = left
+    equation = MOMENTUM
+    component = x
+    h = h
+    q_x = q
+  [../]
+
+  [./h_right]
+    type = ImposedHeightBC
+    variable = h
+    boundary = right
+    equation = CONTINUITY
+    h = h
+    q_x = q
+  [../]
+
+  [./q_right]
+    type = ImposedHeightBC
+    variable = q
+    boundary = right
+    equation = MOMENTUM
+    component = x
+    h = h
+    q_x = q
+  [../]
+[]
+
+[Postprocessors]
+  [./h_left]
+    type = PointValue
+    variable = h
+    point = '0 0 0'
+  [../]
+
+  [./h_right]
+    type = PointValue
+    variable = h
+    point = '100 0 0'
+  [../]
+
+  [./q_left]
+    type = PointValue
+    variable = q
+    point = '0 0 0'
+  [../]
+
+  [./q_right]
+    type = PointValue
+    variable = q
+    point = '100 0 0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = NEWTON
+  end_time = 200
+  dt = 0.5
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = final
+  [../]
+[]
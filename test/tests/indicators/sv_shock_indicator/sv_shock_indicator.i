@@ -0,0 +1,166 @@
+# Dam break onto a dry bed (h = 0 for x >= 0) on 10 elements, of which the
+# front element [-1, 0] is refined twice by SVShockIndicator and a
+# ValueThresholdMarker before the first timestep. SVShockIndicator takes
+# h_dry = 0.25 from the SVWetDryTracker: the lower quadrature point of the
+# front element is dry, and the indicator is 1 there. With the default h_dry
+# it would be the relative jump in height 0.5 * 2 / 0.211 instead.
+
+[GlobalParams]
+  g = 9.81
+  wet_dry = wet_dry
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 10
+  xmin = -5
+  xmax = 5
+[]
+
+[Functions]
+  [./initial_height]
+    type = ParsedFunction
+    value = 'x < 0'
+  [../]
+[]
+
+[Variables]
+  [./h]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_height
+    [../]
+  [../]
+
+  [./q]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./wet_dry]
+    type = SVWetDryTracker
+    h = h
+    h_dry = 0.25
+  [../]
+[]
+
+[Kernels]
+  [./h_time_derivative]
+    type = TimeDerivative
+    variable = h
+  [../]
+
+  [./h_continuity]
+    type = SVContinuity
+    variable = h
+    q_x = q
+  [../]
+
+  [./h_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = h
+  [../]
+
+  [./q_time_derivative]
+    type = TimeDerivative
+    variable = q
+  [../]
+
+  [./q_advection]
+    type = SVAdvection
+    variable = q
+    h = h
+    q_x = q
+    component = x
+  [../]
+
+  [./q_pressure]
+    type = SVPressure
+    variable = q
+    h = h
+    component = x
+  [../]
+
+  [./q_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = q
+  [../]
+[]
+
+[Materials]
+  [./sv_material]
+    type = SVMaterial
+    viscosity_type = FIRST_ORDER
+    h = h
+    q_x = q
+  [../]
+[]
+
+[BCs]
+  [./BC_q]
+    type = DirichletBC
+    variable = q
+    boundary = 'left right'
+    value = 0
+  [../]
+[]
+
+[Adaptivity]
+  marker = shock_marker
+  initial_steps = 2
+  max_h_level = 2
+
+  [./Indicators]
+    [./shock]
+      type = SVShockIndicator
+      variable = h
+    [../]
+  [../]
+
+  [./Markers]
+    [./shock_marker]
+      type = ValueThresholdMarker
+      variable = shock
+      refine = 0.5
+      coarsen = 0.05
+    [../]
+  [../]
+[]
+
+[Postprocessors]
+  # 9 elements of level 0, [-1, -0.5] and the two halves of [-0.5, 0]
+  [./num_elems]
+    type = NumElems
+    execute_on = initial
+  [../]
+
+  [./front]
+    type = PointValue
+    variable = shock
+    point = '-0.1 0 0'
+    execute_on = initial
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  dt = 1e-3
+  num_steps = 1
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = initial
+  [../]
+[]
@@ -0,0 +1,140 @@
+# Dam break of Leveque's case 13.2 (h = 3 | 1, g = 1) with the central-upwind
+# scheme. At t = 1, the middle state of the exact Riemann solution,
+#   h = 1.848577, q = 1.376920,
+# spans -0.615 < x < 1.623 and is sampled at x = 0.505 (within a cell).
+#
+# With Functions/initial_height/vals='3 0', the dam breaks onto a dry bed
+# (Ritter's solution, whose front reaches x = 3.46 at t = 1): the scheme
+# keeps the height nonnegative, and zero ahead of the front.
+
+[GlobalParams]
+  g = 1.0
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1000
+  xmin = -5
+  xmax = 5
+[]
+
+[Functions]
+  [./initial_height]
+    type = ParsedFunction
+    vars = 'h_left h_right'
+    vals = '3 1'
+    value = 'if(x < 0, h_left, h_right)'
+  [../]
+[]
+
+[Variables]
+  [./h]
+    family = MONOMIAL
+    order = CONSTANT
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_height
+    [../]
+  [../]
+
+  [./q]
+    family = MONOMIAL
+    order = CONSTANT
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./fluxes]
+    type = SVCentralUpwindFluxes
+    h = h
+    q_x = q
+  [../]
+[]
+
+[Kernels]
+  [./h_time_derivative]
+    type = TimeDerivative
+    variable = h
+  [../]
+
+  [./q_time_derivative]
+    type = TimeDerivative
+    variable = q
+  [../]
+
+  [./central_upwind]
+    type = SVCentralUpwind
+    variable = h
+    q_x = q
+    fluxes = fluxes
+  [../]
+[]
+
+[BCs]
+  [./BC_q]
+    type = SolidWallBC
+    variable = q
+    equation = MOMENTUM
+    component = x
+    h = h
+    boundary = 'left right'
+  [../]
+[]
+
+[Postprocessors]
+  [./dt]
+    type = TimeStepCFL
+    h = h
+    q_x = q
+    cfl = 0.45
+  [../]
+
+  [./h_middle]
+    type = PointValue
+    variable = h
+    point = '0.505 0 0'
+  [../]
+
+  [./q_middle]
+    type = PointValue
+    variable = q
+    point = '0.505 0 0'
+  [../]
+
+  [./h_min]
+    type = ElementExtremeValue
+    variable = h
+    value_type = min
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = LINEAR
+  end_time = 1
+
+  [./TimeIntegrator]
+    type = SVExplicitSSPRungeKutta
+    order = 2
+  [../]
+
+  [./TimeStepper]
+    type = PostprocessorDT
+    postprocessor = dt
+    dt = 1e-6
+  [../]
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = final
+    hide = dt
+  [../]
+[]
@@ -0,0 +1,141 @@
+# Lake at rest over the immersed bump of SWASHES case 3.1.1 (see
+# examples/swashes/swashes-1d-lake-rest-immersed-bump-fv.i): the
+# central-upwind scheme is well-balanced, so the discharge, and with it the
+# velocity, stays zero (to roundoff).
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 100
+  xmin = 0
+  xmax = 25
+[]
+
+[Functions]
+  [./initial_height]
+    type = ParsedFunction
+    value = '0.5 - (x > 8) * (x < 12) * (0.2 - 0.05 * (x - 10)^2)'
+  [../]
+
+  [./b_func]
+    type = ParsedFunction
+    value = '(x > 8) * (x < 12) * (0.2 - 0.05 * (x - 10)^2)'
+  [../]
+[]
+
+[Variables]
+  [./h]
+    family = MONOMIAL
+    order = CONSTANT
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_height
+    [../]
+  [../]
+
+  [./q]
+    family = MONOMIAL
+    order = CONSTANT
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0
+    [../]
+  [../]
+[]
+
+[AuxVariables]
+  [./b]
+    family = MONOMIAL
+    order = CONSTANT
+    [./InitialCondition]
+      type = FunctionIC
+      function = b_func
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./fluxes]
+    type = SVCentralUpwindFluxes
+    h = h
+    q_x = q
+    b = b
+  [../]
+[]
+
+[Kernels]
+  [./h_time_derivative]
+    type = TimeDerivative
+    variable = h
+  [../]
+
+  [./q_time_derivative]
+    type = TimeDerivative
+    variable = q
+  [../]
+
+  [./central_upwind]
+    type = SVCentralUpwind
+    variable = h
+    q_x = q
+    fluxes = fluxes
+  [../]
+[]
+
+[BCs]
+  [./BC_q]
+    type = SolidWallBC
+    variable = q
+    equation = MOMENTUM
+    component = x
+    h = h
+    boundary = 'left right'
+  [../]
+[]
+
+[Postprocessors]
+  [./dt]
+    type = TimeStepCFL
+    h = h
+    q_x = q
+    cfl = 0.45
+  [../]
+
+  [./q_max]
+    type = ElementExtremeValue
+    variable = q
+    value_type = max
+  [../]
+
+  [./q_min]
+    type = ElementExtremeValue
+    variable = q
+    value_type = min
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = LINEAR
+  end_time = 5
+
+  [./TimeIntegrator]
+    type = SVExplicitSSPRungeKutta
+    order = 2
+  [../]
+
+  [./TimeStepper]
+    type = PostprocessorDT
+    postprocessor = dt
+    dt = 1e-6
+  [../]
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = final
+    hide = dt
+  [../]
+[]
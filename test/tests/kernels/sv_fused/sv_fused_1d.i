@@ -0,0 +1,141 @@
+# Compares SVFused with the kernels that it replaces (SVContinuity,
+# SVAdvection, SVPressure and SVArtificialViscosity) in 1D. SVFused is used
+# by default, and the stack with Kernels/inactive=sv_fused.
+
+[GlobalParams]
+  g = 1.0
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 50
+  xmin = -5
+  xmax = 5
+[]
+
+[Functions]
+  [./initial_height]
+    type = ParsedFunction
+    value = '2 - tanh(2 * x)'
+  [../]
+
+  [./initial_discharge]
+    type = ParsedFunction
+    value = '0.2 * exp(-x * x)'
+  [../]
+[]
+
+[Variables]
+  [./h]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_height
+    [../]
+  [../]
+
+  [./q]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_discharge
+    [../]
+  [../]
+[]
+
+[Kernels]
+  inactive = 'h_continuity h_artificial_viscosity q_advection q_pressure
+              q_artificial_viscosity'
+
+  [./h_time_derivative]
+    type = TimeDerivative
+    variable = h
+  [../]
+
+  [./h_continuity]
+    type = SVContinuity
+    variable = h
+    q_x = q
+  [../]
+
+  [./h_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = h
+  [../]
+
+  [./q_time_derivative]
+    type = TimeDerivative
+    variable = q
+  [../]
+
+  [./q_advection]
+    type = SVAdvection
+    variable = q
+    h = h
+    q_x = q
+    component = x
+  [../]
+
+  [./q_pressure]
+    type = SVPressure
+    variable = q
+    h = h
+    component = x
+  [../]
+
+  [./q_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = q
+  [../]
+
+  [./sv_fused]
+    type = SVFused
+    variable = h
+    q_x = q
+  [../]
+[]
+
+[Materials]
+  [./sv_material]
+    type = SVMaterial
+    viscosity_type = FIRST_ORDER
+    h = h
+    q_x = q
+  [../]
+[]
+
+[BCs]
+  [./BC_q]
+    type = DirichletBC
+    variable = q
+    boundary = 'left right'
+    value = 0
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+
+  dt = 0.01
+  num_steps = 5
+[]
+
+[Outputs]
+  exodus = true
+[]
@@ -0,0 +1,164 @@
+# Dam break of Leveque's case 13.2 (h = 3 | 1, g = 1) with entropy
+# viscosity. At t = 1, the middle state of the exact Riemann solution,
+#   h = 1.848577, q = 1.376920,
+# spans -0.615 < x < 1.623 and is sampled at x = 0.505. The mass of the
+# interpolated initial height, 3 * 5 + 5 - 0.01, is conserved.
+
+[GlobalParams]
+  g = 1.0
+  implicit = false
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1000
+  xmin = -5
+  xmax = 5
+[]
+
+[Functions]
+  [./initial_height]
+    type = ParsedFunction
+    value = '3 * (x < 0) + (x >= 0)'
+  [../]
+[]
+
+[Variables]
+  [./h]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_height
+    [../]
+  [../]
+
+  [./q]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./h_time_derivative]
+    type = TimeDerivative
+    implicit = true
+    variable = h
+  [../]
+
+  [./h_continuity]
+    type = SVContinuity
+    variable = h
+    q_x = q
+  [../]
+
+  [./h_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = h
+  [../]
+
+  [./q_time_derivative]
+    type = TimeDerivative
+    implicit = true
+    variable = q
+  [../]
+
+  [./q_advection]
+    type = SVAdvection
+    variable = q
+    h = h
+    q_x = q
+    component = x
+  [../]
+
+  [./q_pressure]
+    type = SVPressure
+    variable = q
+    h = h
+    component = x
+  [../]
+
+  [./q_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = q
+  [../]
+[]
+
+[Materials]
+  [./sv_material]
+    type = SVMaterial
+    viscosity_type = ENTROPY
+    h = h
+    q_x = q
+  [../]
+[]
+
+[BCs]
+  [./BC_q_left]
+    type = DirichletBC
+    variable = q
+    boundary = left
+    value = 0
+  [../]
+
+  [./BC_q_right]
+    type = DirichletBC
+    variable = q
+    boundary = right
+    value = 0
+  [../]
+[]
+
+[Postprocessors]
+  [./dt]
+    type = TimeStepCFL
+    h = h
+    q_x = q
+    cfl = 0.25
+  [../]
+
+  [./h_middle]
+    type = PointValue
+    variable = h
+    point = '0.505 0 0'
+  [../]
+
+  [./q_middle]
+    type = PointValue
+    variable = q
+    point = '0.505 0 0'
+  [../]
+
+  [./mass]
+    type = ElementIntegralVariablePostprocessor
+    variable = h
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = LINEAR
+  scheme = explicit-euler
+  l_tol = 1e-12
+  end_time = 1
+
+  [./TimeStepper]
+    type = PostprocessorDT
+    postprocessor = dt
+    dt = 1e-6
+  [../]
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = final
+    hide = dt
+  [../]
+[]
@@ -0,0 +1,89 @@
+# The entropy viscosity of SVMaterial at dry and previously dry points, on
+# h = t * (x < 0.5) over five unit elements after one unit timestep: the
+# height is 1 at x = 0 and 0 elsewhere, and was 0 at the previous step.
+# There is no entropy residual to compute, and kappa is the first-order
+# value kappa_max = C_max h_cell (|q| / h + sqrt(g h)) at the quadrature
+# points of the first element, where h = 0.789 and 0.211, and 0 at the dry
+# points. Both integrate to 0.25 (sqrt(0.789) + sqrt(0.211)) = 0.336944.
+
+[GlobalParams]
+  g = 1.0
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 5
+  xmax = 5
+[]
+
+[Functions]
+  [./height]
+    type = ParsedFunction
+    value = 't * (x < 0.5)'
+  [../]
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./h]
+  [../]
+
+  [./q]
+  [../]
+[]
+
+[AuxKernels]
+  [./h]
+    type = FunctionAux
+    variable = h
+    function = height
+    execute_on = 'initial timestep_begin'
+  [../]
+[]
+
+[Kernels]
+  [./u_time_derivative]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[Materials]
+  [./sv_material]
+    type = SVMaterial
+    viscosity_type = ENTROPY
+    h = h
+    q_x = q
+  [../]
+[]
+
+[Postprocessors]
+  [./kappa]
+    type = ElementIntegralMaterialProperty
+    mat_prop = kappa
+  [../]
+
+  [./kappa_max]
+    type = ElementIntegralMaterialProperty
+    mat_prop = kappa_max
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  dt = 1
+  num_steps = 1
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = final
+  [../]
+[]
@@ -0,0 +1,29 @@
+# Runs scenario.i once per row of scenarios.csv and collects the final value
+# of f_value into launcher_results.csv.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Problem]
+  kernel_coverage_check = false
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
+
+[MultiApps]
+  [./launcher]
+    type = SVScenarioLauncher
+    app_type = shallowwaterApp
+    input_files = scenario.i
+    scenarios = scenarios.csv
+    postprocessors = f_value
+    execute_on = timestep_begin
+  [../]
+[]
@@ -0,0 +1,35 @@
+# A scenario of launcher.i without a solve: f_value is a t at the end of the
+# two steps, t = 2 dt, with a and dt set by the scenario table.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Problem]
+  kernel_coverage_check = false
+  solve = false
+[]
+
+[Functions]
+  [./f]
+    type = ParsedFunction
+    vars = 'a'
+    vals = '1'
+    value = 'a * t'
+  [../]
+[]
+
+[Postprocessors]
+  [./f_value]
+    type = FunctionValuePostprocessor
+    function = f
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+[]
@@ -0,0 +1,187 @@
+# Lake at rest (h = 1, g = 1) on a graded mesh of 6 cells: the cell sizes
+# grow by a factor of 1.9, so the CFL timestep of cell i is 1.9^i times the
+# one of the first cell and TimeStepMultirateCFL bins the cells into the
+# levels floor(log2(1.9^i)) = 0 0 1 2 3 4 (the last one capped at
+# max_level = 4). The macro timestep is 2^4 cfl dx_0 / sqrt(g h).
+#
+# With Functions/initial_height/vals='1 100', the first cell is 100 times
+# deeper and its timestep 10 times smaller: the other cells are all on the
+# highest level until the levels are limited to 0 1 2 3 4 4.
+
+[GlobalParams]
+  g = 1.0
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 6
+  xmin = 0
+  xmax = 1
+  bias_x = 1.9
+[]
+
+[Functions]
+  # Within the first cell, which ends at x = 0.01955
+  [./initial_height]
+    type = ParsedFunction
+    vars = 'h0 h_first'
+    vals = '1 1'
+    value = 'if(x < 0.019, h_first, h0)'
+  [../]
+[]
+
+[Variables]
+  [./h]
+    family = MONOMIAL
+    order = CONSTANT
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_height
+    [../]
+  [../]
+
+  [./q]
+    family = MONOMIAL
+    order = CONSTANT
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0
+    [../]
+  [../]
+[]
+
+[AuxVariables]
+  [./level]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[UserObjects]
+  [./fluxes]
+    type = SVCentralUpwindFluxes
+    h = h
+    q_x = q
+    multirate = dt
+  [../]
+[]
+
+[Kernels]
+  [./h_time_derivative]
+    type = TimeDerivative
+    variable = h
+  [../]
+
+  [./q_time_derivative]
+    type = TimeDerivative
+    variable = q
+  [../]
+
+  [./central_upwind]
+    type = SVCentralUpwind
+    variable = h
+    q_x = q
+    fluxes = fluxes
+  [../]
+[]
+
+[AuxKernels]
+  [./level_kernel]
+    type = SVMultirateAux
+    variable = level
+    quantity = LEVEL
+    multirate = dt
+  [../]
+[]
+
+[BCs]
+  [./BC_q]
+    type = SolidWallBC
+    variable = q
+    equation = MOMENTUM
+    component = x
+    h = h
+    boundary = 'left right'
+  [../]
+[]
+
+[Postprocessors]
+  [./dt]
+    type = TimeStepMultirateCFL
+    h = h
+    q_x = q
+    cfl = 0.45
+    max_level = 4
+  [../]
+
+  # Conserved by the multirate steps
+  [./mass]
+    type = ElementIntegralVariablePostprocessor
+    variable = h
+    execute_on = 'initial timestep_end'
+  [../]
+
+  # The levels are exported at the end of the step that follows their computation
+  [./level_0]
+    type = ElementalVariableValue
+    variable = level
+    elementid = 0
+  [../]
+
+  [./level_1]
+    type = ElementalVariableValue
+    variable = level
+    elementid = 1
+  [../]
+
+  [./level_2]
+    type = ElementalVariableValue
+    variable = level
+    elementid = 2
+  [../]
+
+  [./level_3]
+    type = ElementalVariableValue
+    variable = level
+    elementid = 3
+  [../]
+
+  [./level_4]
+    type = ElementalVariableValue
+    variable = level
+    elementid = 4
+  [../]
+
+  [./level_5]
+    type = ElementalVariableValue
+    variable = level
+    elementid = 5
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = LINEAR
+  num_steps = 2
+
+  [./TimeIntegrator]
+    type = SVExplicitSSPRungeKutta
+    order = 1
+    multirate = dt
+  [../]
+
+  [./TimeStepper]
+    type = PostprocessorDT
+    postprocessor = dt
+    dt = 1e-6
+  [../]
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = final
+  [../]
+[]
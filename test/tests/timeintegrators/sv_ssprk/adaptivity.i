@@ -0,0 +1,104 @@
+# The ODEs of ode.i with order 3 on a mesh that is refined uniformly after
+# each of the first two steps. The lumped mass of the children is half the
+# one of their parents: it must be computed again after each refinement for
+# the solution to stay the one of ode.i, now on 8 elements.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 2
+[]
+
+[Functions]
+  [./forcing]
+    type = ParsedFunction
+    value = '3 * t^2'
+  [../]
+[]
+
+[Variables]
+  [./u]
+    family = MONOMIAL
+    order = CONSTANT
+    [./InitialCondition]
+      type = ConstantIC
+      value = 1
+    [../]
+  [../]
+
+  [./v]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[Kernels]
+  [./u_time_derivative]
+    type = TimeDerivative
+    variable = u
+  [../]
+
+  [./u_reaction]
+    type = Reaction
+    variable = u
+  [../]
+
+  [./v_time_derivative]
+    type = TimeDerivative
+    variable = v
+  [../]
+
+  [./v_forcing]
+    type = BodyForce
+    variable = v
+    function = forcing
+  [../]
+[]
+
+[Postprocessors]
+  [./u]
+    type = ElementAverageValue
+    variable = u
+  [../]
+
+  [./v]
+    type = ElementAverageValue
+    variable = v
+  [../]
+
+  [./num_elems]
+    type = NumElems
+  [../]
+[]
+
+[Adaptivity]
+  marker = uniform
+  max_h_level = 2
+
+  [./Markers]
+    [./uniform]
+      type = UniformMarker
+      mark = REFINE
+    [../]
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = LINEAR
+  dt = 0.1
+  num_steps = 10
+
+  [./TimeIntegrator]
+    type = SVExplicitSSPRungeKutta
+    order = 3
+  [../]
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = final
+  [../]
+[]
@@ -0,0 +1,95 @@
+# SVExplicitSSPRungeKutta on u' = -u, u(0) = 1 and v' = 3 t^2, v(0) = 0 over
+# ten steps of 0.1, on elements that do not interact. On u' = -u, a step of
+# the method of order p multiplies u by the Taylor polynomial of exp(-dt) of
+# degree p, so that u(1) = 0.9^10, 0.905^10 and 0.9048333^10 with orders 1,
+# 2 and 3. On v' = 3 t^2, the stages at the times c of the method integrate
+# the forcing with the left rectangle, trapezoidal and Simpson rules, so that
+# v(1) = 0.855, 1.005 and 1 (exactly).
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 2
+[]
+
+[Functions]
+  [./forcing]
+    type = ParsedFunction
+    value = '3 * t^2'
+  [../]
+[]
+
+[Variables]
+  [./u]
+    family = MONOMIAL
+    order = CONSTANT
+    [./InitialCondition]
+      type = ConstantIC
+      value = 1
+    [../]
+  [../]
+
+  [./v]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[Kernels]
+  [./u_time_derivative]
+    type = TimeDerivative
+    variable = u
+  [../]
+
+  [./u_reaction]
+    type = Reaction
+    variable = u
+  [../]
+
+  [./v_time_derivative]
+    type = TimeDerivative
+    variable = v
+  [../]
+
+  [./v_forcing]
+    type = BodyForce
+    variable = v
+    function = forcing
+  [../]
+[]
+
+[Postprocessors]
+  [./u]
+    type = ElementAverageValue
+    variable = u
+  [../]
+
+  [./v]
+    type = ElementAverageValue
+    variable = v
+  [../]
+
+  [./num_elems]
+    type = NumElems
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = LINEAR
+  dt = 0.1
+  num_steps = 10
+
+  [./TimeIntegrator]
+    type = SVExplicitSSPRungeKutta
+    order = 3
+  [../]
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = final
+  [../]
+[]
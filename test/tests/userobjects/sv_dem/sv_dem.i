@@ -0,0 +1,319 @@
+# The faux dam break over the plane b = 0.1 + 0.02 x + 0.01 y read from
+# plane.svdem, which asc2svdem.py writes from plane.asc. The raster covers the
+# mesh, where its bilinear interpolation is exact: SVDEMAux samples b and its
+# gradient without error, and the bathymetry kernels give the solution of the
+# b variant, where b is the aux variable of the gradient component, which is
+# enabled with Kernels/inactive='q_x_bathymetry q_y_bathymetry'.
+
+[GlobalParams]
+  g = 0.05
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 8
+  ny = 8
+  xmax = 4
+  ymax = 4
+[]
+
+[Functions]
+  [./initial_height]
+    type = ParsedFunction
+    value = '0.05 * (x < (2 + 1e-6)) + 0.01 * (x > (2 + 1e-6))'
+  [../]
+
+  [./b]
+    type = ParsedFunction
+    value = '0.1 + 0.02 * x + 0.01 * y'
+  [../]
+
+  [./grad_b_x]
+    type = ConstantFunction
+    value = 0.02
+  [../]
+
+  [./grad_b_y]
+    type = ConstantFunction
+    value = 0.01
+  [../]
+[]
+
+[Variables]
+  [./h]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_height
+    [../]
+  [../]
+
+  [./q_x]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0
+    [../]
+  [../]
+
+  [./q_y]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./dem]
+    type = SVDEM
+    file = plane.svdem
+  [../]
+[]
+
+[AuxVariables]
+  [./b]
+    family = LAGRANGE
+    order = FIRST
+  [../]
+
+  [./dem_grad_b_x]
+    family = LAGRANGE
+    order = FIRST
+  [../]
+
+  [./dem_grad_b_y]
+    family = LAGRANGE
+    order = FIRST
+  [../]
+
+  [./grad_b_x]
+    family = LAGRANGE
+    order = FIRST
+  [../]
+
+  [./grad_b_y]
+    family = LAGRANGE
+    order = FIRST
+  [../]
+[]
+
+[AuxKernels]
+  [./b]
+    type = SVDEMAux
+    variable = b
+    quantity = B
+    dem = dem
+  [../]
+
+  [./dem_grad_b_x]
+    type = SVDEMAux
+    variable = dem_grad_b_x
+    quantity = GRAD_B_X
+    dem = dem
+  [../]
+
+  [./dem_grad_b_y]
+    type = SVDEMAux
+    variable = dem_grad_b_y
+    quantity = GRAD_B_Y
+    dem = dem
+  [../]
+
+  [./grad_b_x]
+    type = FunctionAux
+    variable = grad_b_x
+    function = grad_b_x
+    execute_on = initial
+  [../]
+
+  [./grad_b_y]
+    type = FunctionAux
+    variable = grad_b_y
+    function = grad_b_y
+    execute_on = initial
+  [../]
+[]
+
+[Kernels]
+  inactive = 'q_x_bathymetry_aux q_y_bathymetry_aux'
+
+  [./h_time_derivative]
+    type = TimeDerivative
+    variable = h
+  [../]
+
+  [./h_continuity]
+    type = SVContinuity
+    variable = h
+    q_x = q_x
+    q_y = q_y
+  [../]
+
+  [./h_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = h
+  [../]
+
+  [./q_x_time_derivative]
+    type = TimeDerivative
+    variable = q_x
+  [../]
+
+  [./q_x_advection]
+    type = SVAdvection
+    variable = q_x
+    component = x
+    h = h
+    q_x = q_x
+    q_y = q_y
+  [../]
+
+  [./q_x_pressure]
+    type = SVPressure
+    variable = q_x
+    component = x
+    h = h
+  [../]
+
+  [./q_x_bathymetry]
+    type = SVBathymetry
+    variable = q_x
+    component = x
+    h = h
+    dem = dem
+  [../]
+
+  [./q_x_bathymetry_aux]
+    type = SVBathymetry
+    variable = q_x
+    component = x
+    h = h
+    b = grad_b_x
+  [../]
+
+  [./q_x_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = q_x
+  [../]
+
+  [./q_y_time_derivative]
+    type = TimeDerivative
+    variable = q_y
+  [../]
+
+  [./q_y_advection]
+    type = SVAdvection
+    variable = q_y
+    component = y
+    h = h
+    q_x = q_x
+    q_y = q_y
+  [../]
+
+  [./q_y_pressure]
+    type = SVPressure
+    variable = q_y
+    component = y
+    h = h
+  [../]
+
+  [./q_y_bathymetry]
+    type = SVBathymetry
+    variable = q_y
+    component = y
+    h = h
+    dem = dem
+  [../]
+
+  [./q_y_bathymetry_aux]
+    type = SVBathymetry
+    variable = q_y
+    component = y
+    h = h
+    b = grad_b_y
+  [../]
+
+  [./q_y_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = q_y
+  [../]
+[]
+
+[Materials]
+  [./sv_material]
+    type = SVMaterial
+    viscosity_type = FIRST_ORDER
+    h = h
+    q_x = q_x
+    q_y = q_y
+  [../]
+[]
+
+[BCs]
+  [./BC_h]
+    type = SolidWallBC
+    variable = h
+    equation = CONTINUITY
+    h = h
+    boundary = 'top left bottom right'
+  [../]
+
+  [./BC_qx]
+    type = SolidWallBC
+    variable = q_x
+    equation = MOMENTUM
+    component = x
+    h = h
+    boundary = 'top left bottom right'
+  [../]
+
+  [./BC_qy]
+    type = SolidWallBC
+    variable = q_y
+    equation = MOMENTUM
+    component = y
+    h = h
+    boundary = 'top left bottom right'
+  [../]
+[]
+
+[Postprocessors]
+  [./b_error]
+    type = ElementL2Error
+    variable = b
+    function = b
+  [../]
+
+  [./grad_b_x_error]
+    type = ElementL2Error
+    variable = dem_grad_b_x
+    function = grad_b_x
+  [../]
+
+  [./grad_b_y_error]
+    type = ElementL2Error
+    variable = dem_grad_b_y
+    function = grad_b_y
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  dt = 0.1
+  num_steps = 5
+[]
+
+[Outputs]
+  exodus = true
+  [./csv]
+    type = CSV
+    execute_on = final
+  [../]
+[]
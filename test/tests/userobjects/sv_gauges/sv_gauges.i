@@ -0,0 +1,105 @@
+# SVGauges on the fields h = 1 + x + y / 2 + t, q_x = t (1 + y) and
+# q_y = t x, which the bilinear elements represent exactly, over 25 steps of
+# 1. Every other step is sampled into a buffer of 4 rows, of which the 13
+# rows exceed the capacity: the writer thread writes them two at a time, and
+# the last one is written when SVGauges is destroyed.
+#
+# The discharges are exact with the midpoint rule: through the vertical
+# section s0 to +x, int_0^2 t (1 + y) dy = 4 t; through the horizontal
+# section s1 to +y, int_0^2 t x dx = 2 t; and through s2 to -y, of which the
+# half x > 2 is outside of the mesh, -int_1^2 t x dx = -1.5 t.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+  xmax = 2
+  ymax = 2
+[]
+
+[Functions]
+  [./h]
+    type = ParsedFunction
+    value = '1 + x + y / 2 + t'
+  [../]
+
+  [./q_x]
+    type = ParsedFunction
+    value = 't * (1 + y)'
+  [../]
+
+  [./q_y]
+    type = ParsedFunction
+    value = 't * x'
+  [../]
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./h]
+  [../]
+
+  [./q_x]
+  [../]
+
+  [./q_y]
+  [../]
+[]
+
+[AuxKernels]
+  [./h]
+    type = FunctionAux
+    variable = h
+    function = h
+    execute_on = 'initial timestep_begin'
+  [../]
+
+  [./q_x]
+    type = FunctionAux
+    variable = q_x
+    function = q_x
+    execute_on = 'initial timestep_begin'
+  [../]
+
+  [./q_y]
+    type = FunctionAux
+    variable = q_y
+    function = q_y
+    execute_on = 'initial timestep_begin'
+  [../]
+[]
+
+[Kernels]
+  [./u_time_derivative]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[UserObjects]
+  [./gauges]
+    type = SVGauges
+    h = h
+    q_x = q_x
+    q_y = q_y
+    gauges = '0.3 0.7 0  1.6 1.1 0'
+    gauge_names = 'a b'
+    section_start = '1.25 0 0  2 1.2 0  1 1.2 0'
+    section_end = '1.25 2 0  0 1.2 0  3 1.2 0'
+    interval = 2
+    buffer_size = 4
+    file = sv_gauges.csv
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  dt = 1
+  num_steps = 25
+[]
@@ -0,0 +1,159 @@
+# Dam break onto a dry bed (h = 0 for x > 0) with SVWetDryTracker: the
+# elements ahead of the front are skipped and the velocity is zero at the
+# quadrature points of the halo below h_dry. SVFused is used by default, and
+# the stack that it replaces with Kernels/inactive=sv_fused.
+
+[GlobalParams]
+  g = 9.81
+  implicit = false
+  wet_dry = wet_dry
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 100
+  xmin = -5
+  xmax = 5
+[]
+
+[Functions]
+  [./initial_height]
+    type = ParsedFunction
+    value = '0.005 * (x < 0)'
+  [../]
+[]
+
+[Variables]
+  [./h]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = FunctionIC
+      function = initial_height
+    [../]
+  [../]
+
+  [./q]
+    family = LAGRANGE
+    order = FIRST
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./wet_dry]
+    type = SVWetDryTracker
+    h = h
+    h_dry = 1e-6
+  [../]
+[]
+
+[Kernels]
+  inactive = 'h_continuity h_artificial_viscosity q_advection q_pressure
+              q_artificial_viscosity'
+
+  [./h_time_derivative]
+    type = TimeDerivative
+    implicit = true
+    variable = h
+  [../]
+
+  [./h_continuity]
+    type = SVContinuity
+    variable = h
+    q_x = q
+  [../]
+
+  [./h_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = h
+  [../]
+
+  [./q_time_derivative]
+    type = TimeDerivative
+    implicit = true
+    variable = q
+  [../]
+
+  [./q_advection]
+    type = SVAdvection
+    variable = q
+    h = h
+    q_x = q
+    component = x
+  [../]
+
+  [./q_pressure]
+    type = SVPressure
+    variable = q
+    h = h
+    component = x
+  [../]
+
+  [./q_artificial_viscosity]
+    type = SVArtificialViscosity
+    variable = q
+  [../]
+
+  [./sv_fused]
+    type = SVFused
+    variable = h
+    q_x = q
+  [../]
+[]
+
+[Materials]
+  [./sv_material]
+    type = SVMaterial
+    viscosity_type = FIRST_ORDER
+    h = h
+    q_x = q
+  [../]
+[]
+
+[BCs]
+  [./BC_q]
+    type = DirichletBC
+    variable = q
+    boundary = 'left right'
+    value = 0
+  [../]
+[]
+
+[Postprocessors]
+  [./dt]
+    type = TimeStepCFL
+    h = h
+    q_x = q
+    cfl = 0.25
+  [../]
+
+  # Conserved while the waves are away from the walls
+  [./mass]
+    type = ElementIntegralVariablePostprocessor
+    variable = h
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = LINEAR
+  scheme = explicit-euler
+  l_tol = 1e-12
+  num_steps = 40
+
+  [./TimeStepper]
+    type = PostprocessorDT
+    postprocessor = dt
+    dt = 1e-3
+  [../]
+[]
+
+[Outputs]
+  exodus = true
+[]
@@ -0,0 +1,64 @@
+#ifndef SVMICROBENCHMARK_H
+#define SVMICROBENCHMARK_H
+
+#include "gtest/gtest.h"
+
+// MOOSE includes
+#include "FEProblem.h"
+#include "GeneratedMesh.h"
+#include "MooseApp.h"
+
+// System includes
+#include <functional>
+#include <memory>
+
+/**
+ * Microbenchmarks of the Saint-Venant objects on synthetic element data, in
+ * the style of google benchmark: each benchmark calls an element-level
+ * function of one object (which runs its quadrature point functions) on a
+ * single element until at least min_time seconds have passed, and prints
+ * the time per call and the quadrature points per second.
+ *
+ * The problem is a 2D mesh of 4 x 4 QUAD4 elements with first-order
+ * Lagrange variables h, q_x and q_y set to a smooth fluvial flow, so that
+ * the objects run their common path (and SVBoundaryState its Newton solve)
+ * without a solve. The benchmarks are disabled tests of the unit executable:
+ *
+ *   make -C unit microbenchmark
+ *   ./shallowwater-unit-opt --gtest_also_run_disabled_tests \
+ *                           --gtest_filter='SVMicrobenchmark.*'
+ */
+class SVMicrobenchmark : public ::testing::Test
+{
+protected:
+  SVMicrobenchmark();
+
+  /// Parameters of an object of a type with the coupled variables h, q_x and q_y set
+  InputParameters coupledParams(const std::string & type);
+
+  /// Adds an SVMaterial with first-order viscosity for the objects that use kappa
+  void addViscosity();
+
+  /// Initializes the problem once the objects are added and sets the solution
+  void initProblem();
+
+  /// Prepares the first local element, or its side on a boundary
+  void reinitElem();
+  void reinitSide(const BoundaryName & boundary);
+
+  /// Runs body until min_time has passed and prints the time per call
+  void run(const std::string & name, const std::function<void()> & body);
+
+  /// Minimum time of a benchmark (s)
+  static constexpr Real min_time = 0.5;
+
+  std::shared_ptr<MooseApp> _app;
+  Factory & _factory;
+  std::unique_ptr<MooseMesh> _mesh;
+  std::shared_ptr<FEProblem> _fe_problem;
+
+  /// Element on which the objects are evaluated
+  const Elem * _elem;
+};
+
+#endif